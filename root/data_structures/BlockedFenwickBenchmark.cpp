@@ -0,0 +1,82 @@
+/**
+ * Benchmark of BlockedFenwickTree against FenwickTree: sweeps N = 10^4, 10^5, ... up to maxN,
+ * for every N runs get-heavy (90% getSum, 10% add) and add-heavy (90% add, 10% getSum) mixes of random operations
+ * on both trees and prints times, ratio > 1 means BlockedFenwickTree is faster. Sums of all answers are checked to be equal.
+ *
+ * Usage: BlockedFenwickBenchmark [maxN = 10^8] [Q = 5 * 10^6 operations]
+ *        maxN = 10^9 needs about 24 GB of memory (both trees at once).
+ * Build: g++ -std=c++17 -O2 BlockedFenwickBenchmark.cpp (add -march=native to vectorize add of BlockedFenwickTree)
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "FenwickAddSetPointGetSegSum.cpp"
+#include "BlockedFenwick.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+struct Operation {
+    bool isAdd;
+    int pos;
+    ll val;
+};
+
+template<class Tree>
+double run(Tree& tree, const vector<Operation>& ops, ll& checksum) {
+    auto start = chrono::steady_clock::now();
+    ll sum = 0;
+    for (const auto& op : ops) {
+        if (op.isAdd) {
+            tree.add(op.pos, op.val);
+        } else {
+            sum += tree.getSum(op.pos);
+        }
+    }
+
+    checksum = sum;
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[]) {
+    ll maxN = argc > 1 ? atoll(argv[1]) : 100000000LL;
+    int Q = argc > 2 ? atoi(argv[2]) : 5000000;
+
+    mt19937_64 rng(2024);
+    for (ll n = 10000; n <= maxN; n *= 10) {
+        for (int addPercent : {10, 90}) {
+            vector<Operation> ops(Q);
+            for (auto& op : ops) {
+                op.isAdd = int(rng() % 100) < addPercent;
+                op.pos = int(rng() % n);
+                op.val = ll(rng() % 1000);
+            }
+
+            int sz = int(n);
+            ll fenwickSum = 0;
+            ll blockedSum = 0;
+            double fenwickTime;
+            double blockedTime;
+            {
+                FenwickTree<ll> fenwick(sz);
+                fenwickTime = run(fenwick, ops, fenwickSum);
+            }
+            {
+                BlockedFenwickTree<ll> blocked(sz);
+                blockedTime = run(blocked, ops, blockedSum);
+            }
+
+            if (fenwickSum != blockedSum) {
+                printf("wrong answers for N = %lld: %lld instead of %lld\n", n, blockedSum, fenwickSum);
+                return 1;
+            }
+
+            printf("N %11lld  %s  FenwickTree %7.3f s  BlockedFenwickTree %7.3f s  ratio %5.2f\n",
+                   n, addPercent < 50 ? "get-heavy" : "add-heavy", fenwickTime, blockedTime, fenwickTime / blockedTime);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * Realization of lock-free Disjoint Set Union data structure in C++ (same interface as DSU),
+ * getRoot, unite and sameSet may be called from many threads at the same time without any mutex.
+ * Parent links are atomic, root has parents[v] = v.
+ * Linking by random priorities (Jayanti-Tarjan): a random permutation of vertices is fixed at building,
+ * root of lower priority is attached to root of higher priority by CAS, if the CAS fails (the root was
+ * attached by another thread) unite starts again from the new roots. Links always go to higher priority,
+ * so no cycles can appear.
+ * getRoot is path halving by CAS: a failed CAS means another thread moved the vertex up already, it is ignored.
+ *
+ * TIME: O(N) building + O(logN) expected ask, O(A) amortized in practice
+ * Memory: 2 * N
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <atomic>
+#include <random>
+#include <numeric>
+#include <algorithm>
+
+using namespace std;
+
+class ConcurrentDSU {
+private:
+    vector<atomic<int>> parents;
+    vector<int> priority;
+
+    bool isLower(int v, int u) const {
+        return priority[v] < priority[u];
+    }
+
+public:
+    explicit ConcurrentDSU(int sz, unsigned seed = 0) : parents(sz), priority(sz) {
+        for (int i = 0; i < sz; ++i) {
+            parents[i].store(i, memory_order_relaxed);
+        }
+
+        iota(priority.begin(), priority.end(), 0);
+        shuffle(priority.begin(), priority.end(), mt19937(seed));
+    }
+
+    int getRoot(int v) {
+        while (true) {
+            int parent = parents[v].load(memory_order_acquire);
+            if (parent == v) {
+                return v;
+            }
+
+            int grand = parents[parent].load(memory_order_acquire);
+            if (grand == parent) {
+                return parent;
+            }
+
+            parents[v].compare_exchange_weak(parent, grand, memory_order_acq_rel, memory_order_relaxed);
+            v = grand;
+        }
+    }
+
+    bool unite(int v, int u) {
+        while (true) {
+            v = getRoot(v);
+            u = getRoot(u);
+            if (v == u) {
+                return false;
+            }
+
+            if (isLower(u, v)) {
+                swap(v, u);
+            }
+
+            int expected = v;
+            if (parents[v].compare_exchange_strong(expected, u, memory_order_acq_rel, memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    bool sameSet(int v, int u) {
+        while (true) {
+            v = getRoot(v);
+            u = getRoot(u);
+            if (v == u) {
+                return true;
+            }
+
+            // v is still a root, so at this moment v and u were in different sets
+            if (parents[v].load(memory_order_acquire) == v) {
+                return false;
+            }
+        }
+    }
+};
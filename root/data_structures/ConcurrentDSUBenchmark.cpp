@@ -0,0 +1,109 @@
+/**
+ * Scaling benchmark of ConcurrentDSU against DSU guarded by one mutex (connected components of a random graph):
+ * edges are split between 1, 2, 4, ... threads up to the number of cores, every thread unites its edges.
+ * Prints time and speedup relative to one thread for both structures, and the ratio mutex / lock-free time.
+ * Number of components is checked to be the same as of the sequential DSU for every run.
+ *
+ * Usage: ConcurrentDSUBenchmark [N = 10^7 vertices] [M = 4 * N edges] [maxThreads = hardware_concurrency]
+ * Build: g++ -std=c++17 -O2 -pthread ConcurrentDSUBenchmark.cpp
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "DSU.cpp"
+#include "ConcurrentDSU.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using ll = long long;
+
+template<class Unite>
+double runThreads(const vector<pair<int, int>>& edges, int threadsCnt, Unite unite) {
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    size_t cnt = edges.size();
+    for (int t = 0; t < threadsCnt; ++t) {
+        size_t from = cnt * t / threadsCnt;
+        size_t to = cnt * (t + 1) / threadsCnt;
+        threads.emplace_back([&edges, &unite, from, to]() {
+            for (size_t i = from; i < to; ++i) {
+                unite(edges[i].first, edges[i].second);
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[]) {
+    int N = argc > 1 ? atoi(argv[1]) : 10000000;
+    ll M = argc > 2 ? atoll(argv[2]) : 4LL * N;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : max(int(thread::hardware_concurrency()), 1);
+
+    mt19937 rng(2024);
+    vector<pair<int, int>> edges(M);
+    for (auto& [v, u] : edges) {
+        v = int(rng() % N);
+        u = int(rng() % N);
+    }
+
+    auto start = chrono::steady_clock::now();
+    DSU sequential(N);
+    for (const auto& [v, u] : edges) {
+        sequential.unite(v, u);
+    }
+
+    double sequentialTime = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    int componentsCnt = sequential.components();
+    printf("N = %d, M = %lld, components: %d, sequential DSU %.3f s\n", N, M, componentsCnt, sequentialTime);
+
+    double mutexOneThread = 0;
+    double lockFreeOneThread = 0;
+    for (int threadsCnt = 1;; threadsCnt = min(threadsCnt * 2, maxThreads)) {
+        DSU locked(N);
+        mutex lock;
+        double mutexTime = runThreads(edges, threadsCnt, [&locked, &lock](int v, int u) {
+            lock_guard<mutex> guard(lock);
+            locked.unite(v, u);
+        });
+
+        ConcurrentDSU lockFree(N);
+        double lockFreeTime = runThreads(edges, threadsCnt, [&lockFree](int v, int u) {
+            lockFree.unite(v, u);
+        });
+
+        int lockFreeComponents = 0;
+        for (int v = 0; v < N; ++v) {
+            lockFreeComponents += lockFree.getRoot(v) == v;
+        }
+
+        if (locked.components() != componentsCnt || lockFreeComponents != componentsCnt) {
+            printf("wrong number of components on %d threads: mutex %d, lock-free %d instead of %d\n",
+                   threadsCnt, locked.components(), lockFreeComponents, componentsCnt);
+            return 1;
+        }
+
+        if (threadsCnt == 1) {
+            mutexOneThread = mutexTime;
+            lockFreeOneThread = lockFreeTime;
+        }
+
+        printf("threads %3d  mutex DSU %8.3f s (speedup %5.2f)  ConcurrentDSU %8.3f s (speedup %5.2f)  "
+               "mutex / lock-free %5.2f\n", threadsCnt, mutexTime, mutexOneThread / mutexTime,
+               lockFreeTime, lockFreeOneThread / lockFreeTime, mutexTime / lockFreeTime);
+        if (threadsCnt >= maxThreads) {
+            break;
+        }
+    }
+
+    return 0;
+}
@@ -1,5 +1,8 @@
 /**
  * Realization of Disjoint Set Union data structure in C++.
+ * One array for everything: parents[v] >= 0 is the parent of v, parents[root] = -(size of the set).
+ * getRoot is one pass with path halving (every visited vertex is moved to its grandparent),
+ * unite is by size.
  *
  * TIME: O(N) building + O(A) ask, where A is inverse ackerman function
  * Memory: N
@@ -13,31 +16,24 @@ using namespace std;
 
 class DSU {
 private:
-    vector<int> szs;
     vector<int> parents;
+    int componentsCnt;
 
 public:
-    explicit DSU(int sz) {
-        szs.resize(sz, 1);
-        parents.resize(sz);
-        for (int i = 0; i < sz; ++i) {
-            parents[i] = i;
-        }
-    }
+    explicit DSU(int sz) : parents(sz, -1), componentsCnt(sz) {}
 
     int getRoot(int v) {
-        int root = v;
-        while (parents[root] != root) {
-            root = parents[root];
-        }
+        while (parents[v] >= 0) {
+            int parent = parents[v];
+            if (parents[parent] < 0) {
+                return parent;
+            }
 
-        while (v != root) {
-            int kid = v;
+            parents[v] = parents[parent];
             v = parents[v];
-            parents[kid] = root;
         }
 
-        return root;
+        return v;
     }
 
     bool unite(int v, int u) {
@@ -47,12 +43,22 @@ public:
             return false;
         }
 
-        if (szs[v] < szs[u]) {
+        if (parents[v] > parents[u]) {
             swap(v, u);
         }
 
-        szs[v] += szs[u];
+        parents[v] += parents[u];
         parents[u] = v;
+        --componentsCnt;
         return true;
     }
+
+    // size of the set of v
+    int size(int v) {
+        return -parents[getRoot(v)];
+    }
+
+    int components() const {
+        return componentsCnt;
+    }
 };
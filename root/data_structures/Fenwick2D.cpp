@@ -0,0 +1,88 @@
+/**
+ * Realization of 2D Fenwick tree data structure in C++ for ADD in point and sum query on rectangle.
+ * The tree is stored in one flat array row by row, so a row of the tree is contiguous in memory.
+ *
+ * TIME: O(N * M) building + O(logN * logM) ask and add
+ * Memory: (N + 1) * (M + 1)
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+
+using namespace std;
+
+using ll = long long;
+
+template<class T = ll>
+class Fenwick2D {
+private:
+    int n;
+    int m;
+    // 1-indexed, cell (i, j) is tree[i * (m + 1) + j]
+    vector<T> tree;
+
+    T& cell(int i, int j) {
+        return tree[size_t(i) * (m + 1) + j];
+    }
+
+    T cell(int i, int j) const {
+        return tree[size_t(i) * (m + 1) + j];
+    }
+
+public:
+    Fenwick2D(int n, int m) : n(n), m(m), tree(size_t(n + 1) * (m + 1)) {}
+
+    explicit Fenwick2D(const vector<vector<T>>& src) :
+            n(int(src.size())), m(src.empty() ? 0 : int(src[0].size())), tree(size_t(n + 1) * (m + 1)) {
+        for (int i = 1; i <= n; ++i) {
+            for (int j = 1; j <= m; ++j) {
+                cell(i, j) = src[i - 1][j - 1];
+            }
+        }
+
+        // 2D tree is a 1D tree over rows of 1D trees, so it is built by rows and then by columns
+        for (int i = 1; i <= n; ++i) {
+            for (int j = 1; j <= m; ++j) {
+                int parent = j + (j & -j);
+                if (parent <= m) {
+                    cell(i, parent) += cell(i, j);
+                }
+            }
+        }
+
+        for (int i = 1; i <= n; ++i) {
+            int parent = i + (i & -i);
+            if (parent <= n) {
+                for (int j = 1; j <= m; ++j) {
+                    cell(parent, j) += cell(i, j);
+                }
+            }
+        }
+    }
+
+    void add(int x, int y, T val) {
+        for (int i = x + 1; i <= n; i += i & -i) {
+            for (int j = y + 1; j <= m; j += j & -j) {
+                cell(i, j) += val;
+            }
+        }
+    }
+
+    // sum of the rectangle [0, x] * [0, y]
+    T getSum(int x, int y) const {
+        T sum = 0;
+        for (int i = x + 1; i > 0; i -= i & -i) {
+            for (int j = y + 1; j > 0; j -= j & -j) {
+                sum += cell(i, j);
+            }
+        }
+
+        return sum;
+    }
+
+    // sum of the rectangle [x1, x2] * [y1, y2]
+    T getSum(int x1, int y1, int x2, int y2) const {
+        return getSum(x2, y2) - getSum(x1 - 1, y2) - getSum(x2, y1 - 1) + getSum(x1 - 1, y1 - 1);
+    }
+};
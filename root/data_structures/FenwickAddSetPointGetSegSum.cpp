@@ -1,9 +1,13 @@
 /**
  * Realization of Fenwick tree data structure in C++ for ADD/SET in point and sum query on segment.
+ * T is the type of elements: int, long long, double, ...
+ * lowerBound(sum) finds the shortest prefix with sum >= given by binary lifting,
+ * for non-negative elements (counts) it is k-th order statistic.
+ * FenwickRangeAddRangeSum supports ADD on segment.
  *
  * TIME: O(N) building + O(logN) ask
  * NOTE: ask is very fast, much more than SegmentTree or Binary Trees
- * Memory: N
+ * Memory: 2 * N
  *
  * @author Kirill_Maglysh
 */
@@ -14,44 +18,114 @@ using namespace std;
 
 using ll = long long;
 
+template<class T = ll>
 class FenwickTree {
 private:
-    ll sz;
-    vector<ll> tree;
+    int sz;
+    // 1-indexed, tree[i] is the sum of elements (i - (i & -i), i]
+    vector<T> tree;
+    vector<T> vals;
+
 public:
-    explicit FenwickTree(ll sz) : sz(sz) {
-        tree.resize(sz);
-    }
+    explicit FenwickTree(int sz) : sz(sz), tree(sz + 1), vals(sz) {}
 
-    explicit FenwickTree(const vector<ll>& src) : sz(ll(src.size())) {
-        tree.resize(sz);
-        for (ll i = 0; i < sz; ++i) {
-            add(i, src[i]);
+    explicit FenwickTree(const vector<T>& src) : sz(int(src.size())), tree(sz + 1), vals(src) {
+        for (int i = 1; i <= sz; ++i) {
+            tree[i] += src[i - 1];
+            int parent = i + (i & -i);
+            if (parent <= sz) {
+                tree[parent] += tree[i];
+            }
         }
     }
 
-    void add(ll pos, ll val) {
-        while (pos < sz) {
-            tree[pos] += val;
-            pos |= (pos + 1);
+    void add(int pos, T val) {
+        vals[pos] += val;
+        for (int i = pos + 1; i <= sz; i += i & -i) {
+            tree[i] += val;
         }
     }
 
-    void set(ll pos, ll val) {
-        add(pos, val - getSum(val));
+    void set(int pos, T val) {
+        add(pos, val - vals[pos]);
+    }
+
+    T get(int pos) const {
+        return vals[pos];
     }
 
-    ll getSum(ll l, ll r) {
+    T getSum(int l, int r) const {
         return getSum(r) - getSum(l - 1);
     }
 
-    ll getSum(ll r) {
-        ll sum = 0;
-        while (r >= 0) {
-            sum += tree[r];
-            r = (r & (r + 1)) - 1;
+    T getSum(int r) const {
+        T sum = 0;
+        for (int i = r + 1; i > 0; i -= i & -i) {
+            sum += tree[i];
         }
 
         return sum;
     }
+
+    /**
+     * @return the smallest r with getSum(r) >= sum or -1, all elements must be non-negative
+     */
+    int lowerBound(T sum) const {
+        int pos = 0;
+        for (int step = sz ? 1 << __lg(sz) : 0; step; step >>= 1) {
+            if (pos + step <= sz && tree[pos + step] < sum) {
+                pos += step;
+                sum -= tree[pos];
+            }
+        }
+
+        return pos < sz ? pos : -1;
+    }
+};
+
+/**
+ * Fenwick tree for ADD on segment and sum query on segment, built from two FenwickTree over differences d:
+ * sum of [0, r] = (r + 1) * sum(d[i]) - sum(d[i] * i), i <= r.
+ *
+ * TIME: O(N) building + O(logN) ask and add
+ * Memory: 4 * N
+ */
+template<class T = ll>
+class FenwickRangeAddRangeSum {
+private:
+    FenwickTree<T> diff;
+    FenwickTree<T> diffMulPos;
+
+    static vector<T> diffs(const vector<T>& src, bool mulPos) {
+        vector<T> res(src.size() + 1);
+        for (size_t i = 0; i < src.size(); ++i) {
+            res[i] = src[i] - (i ? src[i - 1] : T(0));
+            if (mulPos) {
+                res[i] *= T(i);
+            }
+        }
+
+        return res;
+    }
+
+public:
+    explicit FenwickRangeAddRangeSum(int sz) : diff(sz + 1), diffMulPos(sz + 1) {}
+
+    explicit FenwickRangeAddRangeSum(const vector<T>& src) :
+            diff(diffs(src, false)), diffMulPos(diffs(src, true)) {}
+
+    void add(int l, int r, T val) {
+        diff.add(l, val);
+        diff.add(r + 1, -val);
+        diffMulPos.add(l, val * T(l));
+        diffMulPos.add(r + 1, -val * T(r + 1));
+    }
+
+    T getSum(int l, int r) const {
+        return getSum(r) - getSum(l - 1);
+    }
+
+    T getSum(int r) const {
+        return diff.getSum(r) * T(r + 1) - diffMulPos.getSum(r);
+    }
 };
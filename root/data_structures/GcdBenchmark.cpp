@@ -0,0 +1,120 @@
+/**
+ * Benchmark of binaryGcd against std::gcd and __gcd (Euclid with division) on random 32-bit and 64-bit pairs,
+ * and of SparseTableGCD (GcdOp, binaryGcd) against the same table with __gcd: building and Q random queries.
+ * All answers are checked to be equal.
+ *
+ * Usage: GcdBenchmark [pairs = 10^7] [N = 10^6 table size] [Q = 10^7 queries]
+ * Build: g++ -std=c++17 -O2 -pthread GcdBenchmark.cpp
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "SparseTable.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+
+template<class T>
+struct EuclidGcdOp {
+    T operator()(const T& a, const T& b) const {
+        return __gcd(a, b);
+    }
+};
+
+double secondsFrom(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+template<class T, class Gcd>
+double timePairs(const vector<T>& a, const vector<T>& b, vector<T>& res, Gcd gcd) {
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < a.size(); ++i) {
+        res[i] = gcd(a[i], b[i]);
+    }
+
+    return secondsFrom(start);
+}
+
+template<class T>
+bool benchmarkPairs(const char *name, int cnt, mt19937_64& rng) {
+    vector<T> a(cnt);
+    vector<T> b(cnt);
+    for (int i = 0; i < cnt; ++i) {
+        // random number of low zero bits, so that common powers of two are met too
+        a[i] = T(rng() >> (rng() % 8)) << (rng() % 4);
+        b[i] = T(rng() >> (rng() % 8)) << (rng() % 4);
+    }
+
+    vector<T> binaryRes(cnt);
+    vector<T> stdRes(cnt);
+    vector<T> euclidRes(cnt);
+    double binaryTime = timePairs(a, b, binaryRes, [](T x, T y) { return binaryGcd(x, y); });
+    double stdTime = timePairs(a, b, stdRes, [](T x, T y) { return gcd(x, y); });
+    double euclidTime = timePairs(a, b, euclidRes, [](T x, T y) { return __gcd(x, y); });
+    if (binaryRes != stdRes || binaryRes != euclidRes) {
+        printf("%s: binaryGcd differs from std::gcd\n", name);
+        return false;
+    }
+
+    printf("%s  binaryGcd %7.3f s  std::gcd %7.3f s  __gcd %7.3f s  speedup %5.2f\n",
+           name, binaryTime, stdTime, euclidTime, stdTime / binaryTime);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int pairsCnt = argc > 1 ? atoi(argv[1]) : 10000000;
+    int N = argc > 2 ? atoi(argv[2]) : 1000000;
+    int Q = argc > 3 ? atoi(argv[3]) : 10000000;
+
+    mt19937_64 rng(2024);
+    if (!benchmarkPairs<uint32_t>("32-bit", pairsCnt, rng) || !benchmarkPairs<uint64_t>("64-bit", pairsCnt, rng)) {
+        return 1;
+    }
+
+    // common factors make gcd of long segments not always 1
+    vector<int> src(N);
+    for (int& x : src) {
+        x = int(rng() % 1000 + 1) * (1 << (rng() % 6)) * (rng() % 3 ? 3 : 1);
+    }
+
+    vector<pair<int, int>> queries(Q);
+    for (auto& [l, r] : queries) {
+        l = int(rng() % N);
+        r = min(N - 1, l + int(rng() % 64));
+    }
+
+    auto start = chrono::steady_clock::now();
+    SparseTableGCD binaryTable(src);
+    double binaryBuild = secondsFrom(start);
+
+    start = chrono::steady_clock::now();
+    SparseTable<int, EuclidGcdOp<int>> euclidTable(src);
+    double euclidBuild = secondsFrom(start);
+
+    vector<int> binaryRes(Q);
+    vector<int> euclidRes(Q);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < Q; ++i) {
+        binaryRes[i] = binaryTable.ask(queries[i].first, queries[i].second);
+    }
+    double binaryAsk = secondsFrom(start);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < Q; ++i) {
+        euclidRes[i] = euclidTable.ask(queries[i].first, queries[i].second);
+    }
+    double euclidAsk = secondsFrom(start);
+
+    if (binaryRes != euclidRes) {
+        printf("SparseTableGCD: answers differ from __gcd table\n");
+        return 1;
+    }
+
+    printf("SparseTableGCD N = %d, Q = %d\n", N, Q);
+    printf("build  GcdOp %7.3f s  __gcd %7.3f s  speedup %5.2f\n", binaryBuild, euclidBuild, euclidBuild / binaryBuild);
+    printf("ask    GcdOp %7.3f s  __gcd %7.3f s  speedup %5.2f\n", binaryAsk, euclidAsk, euclidAsk / binaryAsk);
+    return 0;
+}
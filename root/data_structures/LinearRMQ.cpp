@@ -0,0 +1,99 @@
+/**
+ * Realization of Range Minimum Query with linear memory in C++ (drop-in replacement of SparseTableMin/Max).
+ * Array is split into blocks of 64 elements, a sparse table is built over block minimums,
+ * and for every position i a 64-bit mask of the monotone stack of its block prefix is stored,
+ * so the minimum inside a block is found by one ctz.
+ * Compare = less<T> gives minimum, greater<T> gives maximum.
+ *
+ * TIME: O(N) building + O(1) ask
+ * Memory: N * (sizeof(T) + 8) + N / 64 * log(N / 64) * sizeof(T)
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+using namespace std;
+
+template<class T, class Compare = less<T>>
+class LinearRMQ {
+private:
+    static const int BLOCK_LOG = 6;
+    static const int BLOCK = 1 << BLOCK_LOG;
+
+    int n;
+    int blocksCnt;
+    vector<T> vals;
+    vector<uint64_t> masks;
+    // sparse table over block minimums, level j occupies st[j * blocksCnt, (j + 1) * blocksCnt)
+    vector<T> st;
+    Compare cmp;
+
+    T best(const T& a, const T& b) const {
+        return cmp(b, a) ? b : a;
+    }
+
+    // l and r are in the same block
+    T askInBlock(int l, int r) const {
+        uint64_t mask = masks[r] & (~0ULL << (l & (BLOCK - 1)));
+        return vals[(r & ~(BLOCK - 1)) + __builtin_ctzll(mask)];
+    }
+
+    T askBlocks(int l, int r) const {
+        int j = __lg(r - l + 1);
+        const T *level = st.data() + size_t(j) * blocksCnt;
+        return best(level[l], level[r - (1 << j) + 1]);
+    }
+
+public:
+    explicit LinearRMQ(const vector<T>& src, Compare cmp = Compare()) :
+            n(int(src.size())), blocksCnt((n + BLOCK - 1) >> BLOCK_LOG), vals(src), masks(n), cmp(cmp) {
+        int levels = blocksCnt ? __lg(blocksCnt) + 1 : 0;
+        st.resize(size_t(levels) * blocksCnt);
+        for (int b = 0; b < blocksCnt; ++b) {
+            int start = b << BLOCK_LOG;
+            int finish = min(n, start + BLOCK);
+            uint64_t stack = 0;
+            for (int i = start; i < finish; ++i) {
+                while (stack && !cmp(vals[start + 63 - __builtin_clzll(stack)], vals[i])) {
+                    stack ^= 1ULL << (63 - __builtin_clzll(stack));
+                }
+
+                stack |= 1ULL << (i - start);
+                masks[i] = stack;
+            }
+
+            st[b] = vals[start + __builtin_ctzll(stack)];
+        }
+
+        for (int j = 1; j < levels; ++j) {
+            const T *prev = st.data() + size_t(j - 1) * blocksCnt;
+            T *cur = st.data() + size_t(j) * blocksCnt;
+            int half = 1 << (j - 1);
+            int cnt = blocksCnt - (1 << j) + 1;
+            for (int i = 0; i < cnt; ++i) {
+                cur[i] = best(prev[i], prev[i + half]);
+            }
+        }
+    }
+
+    T ask(int l, int r) const {
+        int bl = l >> BLOCK_LOG;
+        int br = r >> BLOCK_LOG;
+        if (bl == br) {
+            return askInBlock(l, r);
+        }
+
+        T res = best(askInBlock(l, (bl << BLOCK_LOG) + BLOCK - 1), askInBlock(br << BLOCK_LOG, r));
+        if (bl + 1 < br) {
+            res = best(res, askBlocks(bl + 1, br - 1));
+        }
+
+        return res;
+    }
+};
+
+using LinearRMQMin = LinearRMQ<int>;
+using LinearRMQMax = LinearRMQ<int, greater<int>>;
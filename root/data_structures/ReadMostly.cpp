@@ -0,0 +1,44 @@
+/**
+ * Realization of read-mostly publication of any data structure (segment trees, Fenwick tree, ...) in C++
+ * for many reader threads and one writer thread.
+ * Writer changes its private copy and calls publish(), which makes an immutable snapshot of it.
+ * Reader takes the current snapshot by acquire() and uses only const methods of it
+ * (e.g. SegTree getters on a const object or FenwickTree::getSum), the snapshot lives while somebody holds it.
+ * So readers never wait for the writer and never see a half-applied update, and there are at most
+ * a few copies of the structure instead of one per thread.
+ *
+ * TIME: O(1) acquire, O(size of T) publish
+ * Memory: 2 * size of T + snapshots still held by readers
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <memory>
+#include <atomic>
+
+using namespace std;
+
+template<class T>
+class ReadMostly {
+private:
+    shared_ptr<const T> published;
+    T draft;
+
+public:
+    explicit ReadMostly(T src) : published(make_shared<const T>(src)), draft(std::move(src)) {}
+
+    // for readers, any thread
+    shared_ptr<const T> acquire() const {
+        return atomic_load(&published);
+    }
+
+    // for the writer only
+    T& edit() {
+        return draft;
+    }
+
+    // for the writer only, readers see all changes made by edit() since the last publish
+    void publish() {
+        atomic_store(&published, shared_ptr<const T>(make_shared<const T>(draft)));
+    }
+};
@@ -0,0 +1,207 @@
+/**
+ * Realization of Disjoint Set Union data structure with rollback in C++ (same interface as DSU).
+ * Union by size without path compression, so every unite changes exactly two cells and can be undone:
+ * they are saved in the history stack. snapshot() returns the current state, rollback(state) undoes all unites after it.
+ *
+ * DynamicConnectivity answers offline "are v and u connected" between additions and removals of edges
+ * (segment tree over time): every edge is alive on a segment of time, it is added to O(logT) nodes of the tree,
+ * DFS over the tree unites edges of the node on the way down and rolls them back on the way up.
+ *
+ * TIME: O(N) building + O(logN) ask, rollback is O(1) per undone unite
+ *       DynamicConnectivity: O(T * logT * logN), T - number of operations
+ * Memory: N + history (at most 2 * N)
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+using namespace std;
+
+class RollbackDSU {
+private:
+    // parents[v] >= 0 is the parent of v, parents[root] = -(size of the set)
+    vector<int> parents;
+    int componentsCnt;
+    // attached root and its old value, parent gets -(its size) back from it
+    vector<pair<int, int>> history;
+
+public:
+    explicit RollbackDSU(int sz) : parents(sz, -1), componentsCnt(sz) {}
+
+    int getRoot(int v) const {
+        while (parents[v] >= 0) {
+            v = parents[v];
+        }
+
+        return v;
+    }
+
+    bool unite(int v, int u) {
+        v = getRoot(v);
+        u = getRoot(u);
+        if (v == u) {
+            return false;
+        }
+
+        if (parents[v] > parents[u]) {
+            swap(v, u);
+        }
+
+        history.emplace_back(u, parents[u]);
+        parents[v] += parents[u];
+        parents[u] = v;
+        --componentsCnt;
+        return true;
+    }
+
+    bool sameSet(int v, int u) const {
+        return getRoot(v) == getRoot(u);
+    }
+
+    // size of the set of v
+    int size(int v) const {
+        return -parents[getRoot(v)];
+    }
+
+    int components() const {
+        return componentsCnt;
+    }
+
+    int snapshot() const {
+        return int(history.size());
+    }
+
+    // undoes all unites made after snapshot() returned state
+    void rollback(int state) {
+        while (int(history.size()) > state) {
+            int u = history.back().first;
+            int old = history.back().second;
+            history.pop_back();
+            parents[parents[u]] -= old;
+            parents[u] = old;
+            ++componentsCnt;
+        }
+    }
+};
+
+/**
+ * Operations are recorded by addEdge, removeEdge and ask, then solve() answers all asks in their order.
+ * Multiple edges are allowed, removeEdge removes one copy of an existing edge.
+ * solve() may be called again after more operations.
+ */
+class DynamicConnectivity {
+private:
+    struct Query {
+        int v;
+        int u;
+    };
+
+    int sz;
+    // time of every operation is its index
+    int opsCnt = 0;
+    map<pair<int, int>, vector<int>> openEdges;
+    // edge and its alive time [from, to)
+    vector<pair<pair<int, int>, pair<int, int>>> edges;
+    vector<pair<int, Query>> queries;
+
+    vector<vector<pair<int, int>>> tree;
+    vector<int> queryAt;
+
+    static pair<int, int> key(int v, int u) {
+        return {min(v, u), max(v, u)};
+    }
+
+    void addToTree(int root, int l, int r, int sL, int sR, const pair<int, int>& edge) {
+        if (sL <= l && r <= sR) {
+            tree[root].push_back(edge);
+            return;
+        }
+
+        int m = (l + r) >> 1;
+        if (sL <= m) {
+            addToTree(root * 2 + 1, l, m, sL, sR, edge);
+        }
+
+        if (m < sR) {
+            addToTree(root * 2 + 2, m + 1, r, sL, sR, edge);
+        }
+    }
+
+    void dfs(int root, int l, int r, RollbackDSU& dsu, vector<bool>& res) {
+        int state = dsu.snapshot();
+        for (const auto& edge : tree[root]) {
+            dsu.unite(edge.first, edge.second);
+        }
+
+        if (l == r) {
+            if (queryAt[l] != -1) {
+                const Query& query = queries[queryAt[l]].second;
+                res[queryAt[l]] = dsu.sameSet(query.v, query.u);
+            }
+        } else {
+            int m = (l + r) >> 1;
+            dfs(root * 2 + 1, l, m, dsu, res);
+            dfs(root * 2 + 2, m + 1, r, dsu, res);
+        }
+
+        dsu.rollback(state);
+    }
+
+public:
+    explicit DynamicConnectivity(int sz) : sz(sz) {}
+
+    void addEdge(int v, int u) {
+        openEdges[key(v, u)].push_back(opsCnt++);
+    }
+
+    void removeEdge(int v, int u) {
+        auto it = openEdges.find(key(v, u));
+        edges.push_back({it->first, {it->second.back(), opsCnt++}});
+        it->second.pop_back();
+        if (it->second.empty()) {
+            openEdges.erase(it);
+        }
+    }
+
+    // are v and u connected after all operations recorded before
+    void ask(int v, int u) {
+        queries.push_back({opsCnt++, {v, u}});
+    }
+
+    /**
+     * @return answers to asks in the order of the calls
+     */
+    vector<bool> solve() {
+        vector<bool> res(queries.size());
+        if (queries.empty()) {
+            return res;
+        }
+
+        auto alive = edges;
+        for (const auto& edge : openEdges) {
+            for (int from : edge.second) {
+                alive.push_back({edge.first, {from, opsCnt}});
+            }
+        }
+
+        tree.assign(4 * opsCnt, {});
+        queryAt.assign(opsCnt, -1);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            queryAt[queries[i].first] = int(i);
+        }
+
+        for (const auto& edge : alive) {
+            // the edge is added at time from, so it is alive for the operations after it
+            if (edge.second.first + 1 < edge.second.second) {
+                addToTree(0, 0, opsCnt - 1, edge.second.first + 1, edge.second.second - 1, edge.first);
+            }
+        }
+
+        RollbackDSU dsu(sz);
+        dfs(0, 0, opsCnt - 1, dsu, res);
+        return res;
+    }
+};
@@ -0,0 +1,202 @@
+/**
+ * Realization of Sparse Table data structure in C++ for any idempotent operation (min, max, gcd, and, or, ...).
+ * Op is a functor type, so the compiler inlines it both in building and in ask.
+ * All levels are stored in one contiguous buffer, level of the query is taken by __lg (single bsr instruction),
+ * so ask makes exactly two memory loads. Building of every level is a plain loop, vectorized by the compiler.
+ * askBatch answers arrays of queries, prefetching the cells of queries PREFETCH_DIST steps ahead,
+ * so independent cache misses overlap; big batches can be split between threads.
+ *
+ * TIME: O(N*logN) building + O(1) ask (O(log_2(Max_A)) for GCD)
+ * Memory: N*logN
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+
+using namespace std;
+using ll = long long;
+using ull = unsigned long long;
+
+template<class T>
+struct MinOp {
+    T operator()(const T& a, const T& b) const {
+        return min(a, b);
+    }
+};
+
+template<class T>
+struct MaxOp {
+    T operator()(const T& a, const T& b) const {
+        return max(a, b);
+    }
+};
+
+/**
+ * Stein's binary GCD: only shifts, subtractions and ctz, no division.
+ * Works for any signed or unsigned integers up to 64 bits, the result is equal to std::gcd.
+ * Computes on 64-bit magnitudes: a separate 32-bit kernel was measured to be not faster.
+ */
+template<class T>
+T binaryGcd(T a, T b) {
+    ull x = ull(a);
+    ull y = ull(b);
+    if constexpr (is_signed_v<T>) {
+        x = a < 0 ? 0 - x : x;
+        y = b < 0 ? 0 - y : y;
+    }
+
+    // equal arguments are the most common case in sparse table queries
+    if (x == y || !x || !y) {
+        return T(x | y);
+    }
+
+    // the kernel needs magnitudes below 2^63, one or two divisions make them so
+    if constexpr (sizeof(T) >= sizeof(ull)) {
+        while ((x | y) >> 63) {
+            if (x < y) {
+                swap(x, y);
+            }
+
+            x %= y;
+            if (!x) {
+                return T(y);
+            }
+        }
+    }
+
+    // signed difference lets the compiler use branch-free abs and min
+    ll sx = ll(x);
+    ll sy = ll(y);
+    int xz = __builtin_ctzll(x);
+    int yz = __builtin_ctzll(y);
+    int shift = min(xz, yz);
+    sy >>= yz;
+    while (sx) {
+        sx >>= xz;
+        ll diff = sy - sx;
+        // the highest bit keeps ctz argument non-zero, the loop stops on diff == 0 anyway
+        xz = __builtin_ctzll(ull(diff) | (1ULL << 63));
+        sy = min(sx, sy);
+        sx = diff < 0 ? -diff : diff;
+    }
+
+    return T(ull(sy) << shift);
+}
+
+/**
+ * GCD of src[l..r] by linear scan, which stops as soon as the gcd becomes 1.
+ * Useful for single queries when building a table is not worth it.
+ */
+template<class T>
+T rangeGcd(const vector<T>& src, int l, int r) {
+    T res = 0;
+    for (int i = l; i <= r && res != 1; ++i) {
+        res = binaryGcd(res, src[i]);
+    }
+
+    return res;
+}
+
+/**
+ * In sparse table queries the two halves are equal or divide each other most of the time:
+ * one division catches that, the rest goes to binaryGcd.
+ */
+template<class T>
+struct GcdOp {
+    T operator()(const T& a, const T& b) const {
+        using U = make_unsigned_t<T>;
+        U x = U(a);
+        U y = U(b);
+        if constexpr (is_signed_v<T>) {
+            x = a < 0 ? U(0 - x) : x;
+            y = b < 0 ? U(0 - y) : y;
+        }
+
+        if (x == y || !x || !y) {
+            return T(x | y);
+        }
+
+        if (x < y) {
+            swap(x, y);
+        }
+
+        U rem = U(x % y);
+        return rem ? T(binaryGcd(y, rem)) : T(y);
+    }
+};
+
+template<class T, class Op>
+class SparseTable {
+private:
+    int n;
+    // level j occupies st[j * n, j * n + n - (1 << j)]
+    vector<T> st;
+    Op op;
+
+public:
+    explicit SparseTable(const vector<T>& src, Op op = Op()) : n(int(src.size())), op(op) {
+        int levels = n ? __lg(n) + 1 : 0;
+        st.resize(size_t(levels) * n);
+        copy(src.begin(), src.end(), st.begin());
+        for (int j = 1; j < levels; j++) {
+            const T *prev = st.data() + size_t(j - 1) * n;
+            T *cur = st.data() + size_t(j) * n;
+            int half = 1 << (j - 1);
+            int cnt = n - (1 << j) + 1;
+            for (int i = 0; i < cnt; i++) {
+                cur[i] = op(prev[i], prev[i + half]);
+            }
+        }
+    }
+
+    T ask(int l, int r) const {
+        int j = __lg(r - l + 1);
+        const T *level = st.data() + size_t(j) * n;
+        return op(level[l], level[r - (1 << j) + 1]);
+    }
+
+    void askBatch(const pair<int, int> *queries, size_t cnt, T *res) const {
+        const size_t PREFETCH_DIST = 16;
+        for (size_t i = 0; i < cnt; ++i) {
+            if (i + PREFETCH_DIST < cnt) {
+                auto [l, r] = queries[i + PREFETCH_DIST];
+                int j = __lg(r - l + 1);
+                const T *level = st.data() + size_t(j) * n;
+                __builtin_prefetch(level + l);
+                __builtin_prefetch(level + r - (1 << j) + 1);
+            }
+
+            res[i] = ask(queries[i].first, queries[i].second);
+        }
+    }
+
+    vector<T> askBatch(const vector<pair<int, int>>& queries, int threadsCnt = 1) const {
+        vector<T> res(queries.size());
+        size_t cnt = queries.size();
+        threadsCnt = max(threadsCnt, 1);
+        size_t parts = min<size_t>(threadsCnt, max<size_t>(cnt, 1));
+        vector<thread> threads;
+        for (size_t t = 1; t < parts; ++t) {
+            size_t from = cnt * t / parts;
+            size_t to = cnt * (t + 1) / parts;
+            threads.emplace_back([this, &queries, &res, from, to]() {
+                askBatch(queries.data() + from, to - from, res.data() + from);
+            });
+        }
+
+        askBatch(queries.data(), cnt / parts, res.data());
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        return res;
+    }
+};
+
+using SparseTableMin = SparseTable<int, MinOp<int>>;
+using SparseTableMax = SparseTable<int, MaxOp<int>>;
+using SparseTableGCD = SparseTable<int, GcdOp<int>>;
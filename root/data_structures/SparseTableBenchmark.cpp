@@ -0,0 +1,116 @@
+/**
+ * Benchmark of SparseTableMin (flat buffer, __lg) against the previous layout (vector<vector<int>> + log2 table,
+ * copied below as OldSparseTableMin): building and Q random queries on N random elements, ask one by one and askBatch.
+ * Queries are generated by blocks outside of the timed part, every answer is checked to be the same in both layouts.
+ *
+ * Usage: SparseTableBenchmark [N = 10^7] [Q = 10^8]
+ * Build: g++ -std=c++17 -O2 -pthread SparseTableBenchmark.cpp
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "SparseTable.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+// SparseTableMin.cpp before the flat buffer layout
+class OldSparseTableMin {
+private:
+    vector<vector<int>> st;
+    vector<int> log2;
+public:
+    explicit OldSparseTableMin(vector<int>& src) {
+        int n = int(src.size());
+        log2.resize(n + 1);
+        for (int i = 2; i <= n; i++) {
+            log2[i] = log2[i >> 1] + 1;
+        }
+        st.resize(log2[n] + 1, vector<int>(n));
+        for (int i = 0; i < n; i++) {
+            st[0][i] = src[i];
+        }
+        for (int j = 1; j <= log2[n]; j++) {
+            for (int i = 0; i + (1 << j) <= n; i++) {
+                st[j][i] = min(st[j - 1][i], st[j - 1][i + (1 << (j - 1))]);
+            }
+        }
+    }
+
+    int ask(int l, int r) {
+        int j = log2[r - l + 1];
+        return min(st[j][l], st[j][r - (1 << j) + 1]);
+    }
+};
+
+double secondsFrom(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[]) {
+    int N = argc > 1 ? atoi(argv[1]) : 10000000;
+    ll Q = argc > 2 ? atoll(argv[2]) : 100000000LL;
+    const int BLOCK = 1 << 20;
+
+    mt19937 rng(2024);
+    vector<int> src(N);
+    for (int& x : src) {
+        x = int(rng());
+    }
+
+    auto start = chrono::steady_clock::now();
+    OldSparseTableMin oldTable(src);
+    double oldBuild = secondsFrom(start);
+
+    start = chrono::steady_clock::now();
+    SparseTableMin table(src);
+    double newBuild = secondsFrom(start);
+
+    double oldAsk = 0;
+    double newAsk = 0;
+    double newBatch = 0;
+    vector<pair<int, int>> queries(BLOCK);
+    vector<int> oldRes(BLOCK);
+    vector<int> newRes(BLOCK);
+    vector<int> batchRes(BLOCK);
+    for (ll done = 0; done < Q; done += BLOCK) {
+        int cnt = int(min<ll>(BLOCK, Q - done));
+        for (int i = 0; i < cnt; ++i) {
+            int l = int(rng() % N);
+            int r = int(rng() % N);
+            queries[i] = {min(l, r), max(l, r)};
+        }
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < cnt; ++i) {
+            oldRes[i] = oldTable.ask(queries[i].first, queries[i].second);
+        }
+        oldAsk += secondsFrom(start);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < cnt; ++i) {
+            newRes[i] = table.ask(queries[i].first, queries[i].second);
+        }
+        newAsk += secondsFrom(start);
+
+        start = chrono::steady_clock::now();
+        table.askBatch(queries.data(), cnt, batchRes.data());
+        newBatch += secondsFrom(start);
+
+        for (int i = 0; i < cnt; ++i) {
+            if (oldRes[i] != newRes[i] || oldRes[i] != batchRes[i]) {
+                printf("wrong answer for [%d, %d]: %d and %d instead of %d\n",
+                       queries[i].first, queries[i].second, newRes[i], batchRes[i], oldRes[i]);
+                return 1;
+            }
+        }
+    }
+
+    printf("N = %d, Q = %lld\n", N, Q);
+    printf("build     old %7.3f s  new %7.3f s  speedup %5.2f\n", oldBuild, newBuild, oldBuild / newBuild);
+    printf("ask       old %7.3f s  new %7.3f s  speedup %5.2f\n", oldAsk, newAsk, oldAsk / newAsk);
+    printf("askBatch  old %7.3f s  new %7.3f s  speedup %5.2f\n", oldAsk, newBatch, oldAsk / newBatch);
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * Realization of dynamic (implicit) Segment tree data structure in C++ for MAX, MIN, SUM, ADD queries
+ * on segments [l, r] and set for pos (same interface as SegTreeMxMnSumAddSet) over coordinates [0, maxCoord),
+ * maxCoord up to 2^62, without coordinate compression.
+ * Nodes are created only on the paths of updates and are taken from one pool (bump allocation in a vector),
+ * a missing subtree means that all its elements are equal to def.
+ * Tags are never pushed: node value includes all adds of its subtree, queries add tags of the ancestors.
+ *
+ * NOTE: sums are computed modulo 2^64 (unsigned), so wide adds and huge segments of def != 0 never overflow,
+ * getSum is correct whenever the real sum of the asked segment fits in long long.
+ *
+ * TIME: O(log(maxCoord)) ask and update
+ * Memory: O(Q * log(maxCoord)) nodes, Q - number of updates
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+using ll = long long;
+using ull = unsigned long long;
+
+class DynamicSegTree {
+private:
+    struct Node {
+        ll mn;
+        ll mx;
+        ull sum;
+        ll lazy;
+        int l;
+        int r;
+    };
+
+    ll maxCoord;
+    ll def;
+    int root = -1;
+    vector<Node> pool;
+
+    int newNode(ll len) {
+        pool.push_back({def, def, ull(def) * ull(len), 0, -1, -1});
+        return int(pool.size()) - 1;
+    }
+
+    Node valueOf(int v, ll len) const {
+        if (v == -1) {
+            return {def, def, ull(def) * ull(len), 0, -1, -1};
+        }
+
+        return pool[v];
+    }
+
+    void pull(int v, ll l, ll r) {
+        ll m = (l + r) >> 1;
+        Node L = valueOf(pool[v].l, m - l + 1);
+        Node R = valueOf(pool[v].r, r - m);
+        Node& node = pool[v];
+        node.mn = min(L.mn, R.mn) + node.lazy;
+        node.mx = max(L.mx, R.mx) + node.lazy;
+        node.sum = L.sum + R.sum + ull(node.lazy) * ull(r - l + 1);
+    }
+
+    int add(int v, ll l, ll r, ll sL, ll sR, ll val) {
+        if (v == -1) {
+            v = newNode(r - l + 1);
+        }
+
+        if (sL <= l && r <= sR) {
+            Node& node = pool[v];
+            node.mn += val;
+            node.mx += val;
+            node.sum += ull(val) * ull(r - l + 1);
+            node.lazy += val;
+            return v;
+        }
+
+        ll m = (l + r) >> 1;
+        if (sL <= m) {
+            int kid = add(pool[v].l, l, m, sL, sR, val);
+            pool[v].l = kid;
+        }
+
+        if (m < sR) {
+            int kid = add(pool[v].r, m + 1, r, sL, sR, val);
+            pool[v].r = kid;
+        }
+
+        pull(v, l, r);
+        return v;
+    }
+
+    // above - sum of tags of the ancestors of v
+    int set(int v, ll l, ll r, ll pos, ll val, ll above) {
+        if (v == -1) {
+            v = newNode(r - l + 1);
+        }
+
+        if (l == r) {
+            pool[v] = {val - above, val - above, ull(val - above), 0, -1, -1};
+            return v;
+        }
+
+        ll m = (l + r) >> 1;
+        ll nextAbove = above + pool[v].lazy;
+        if (pos <= m) {
+            int kid = set(pool[v].l, l, m, pos, val, nextAbove);
+            pool[v].l = kid;
+        } else {
+            int kid = set(pool[v].r, m + 1, r, pos, val, nextAbove);
+            pool[v].r = kid;
+        }
+
+        pull(v, l, r);
+        return v;
+    }
+
+    // value of [sL, sR] inside subtree of v, including tag of v, but not of its ancestors
+    Node get(int v, ll l, ll r, ll sL, ll sR) const {
+        if (v == -1) {
+            return valueOf(v, min(r, sR) - max(l, sL) + 1);
+        }
+
+        const Node& node = pool[v];
+        if (sL <= l && r <= sR) {
+            return node;
+        }
+
+        ll m = (l + r) >> 1;
+        Node res;
+        if (sR <= m) {
+            res = get(node.l, l, m, sL, sR);
+        } else if (m < sL) {
+            res = get(node.r, m + 1, r, sL, sR);
+        } else {
+            Node L = get(node.l, l, m, sL, sR);
+            Node R = get(node.r, m + 1, r, sL, sR);
+            res = {min(L.mn, R.mn), max(L.mx, R.mx), L.sum + R.sum, 0, -1, -1};
+        }
+
+        res.mn += node.lazy;
+        res.mx += node.lazy;
+        res.sum += ull(node.lazy) * ull(min(r, sR) - max(l, sL) + 1);
+        return res;
+    }
+
+public:
+    /**
+     * @param nodesHint expected number of nodes, used only to reserve the pool
+     */
+    explicit DynamicSegTree(ll maxCoord = 1LL << 62, ll def = 0, size_t nodesHint = 0) :
+            maxCoord(maxCoord), def(def) {
+        pool.reserve(nodesHint);
+    }
+
+    ll getMx(ll l, ll r) const {
+        return get(root, 0, maxCoord - 1, l, r).mx;
+    }
+
+    ll getMn(ll l, ll r) const {
+        return get(root, 0, maxCoord - 1, l, r).mn;
+    }
+
+    ll getSum(ll l, ll r) const {
+        return ll(get(root, 0, maxCoord - 1, l, r).sum);
+    }
+
+    ll getVal(ll pos) const {
+        return getSum(pos, pos);
+    }
+
+    void add(ll l, ll r, ll val) {
+        root = add(root, 0, maxCoord - 1, l, r, val);
+    }
+
+    void add(ll pos, ll val) {
+        add(pos, pos, val);
+    }
+
+    void set(ll pos, ll val) {
+        root = set(root, 0, maxCoord - 1, pos, val, 0);
+    }
+
+    size_t nodesCnt() const {
+        return pool.size();
+    }
+};
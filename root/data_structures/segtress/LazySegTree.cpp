@@ -0,0 +1,1015 @@
+/**
+ * Realization of generic lazy Segment tree data structure in C++.
+ * Tree is parameterized by a value Monoid (what is stored in a node) and by an Action (what update is applied),
+ * so a node stores only the fields the chosen monoid needs.
+ *
+ * Monoid M must provide:
+ *      M::Value                                node value
+ *      M::id(), M::leaf(ll x)                  identity and value of one element x
+ *      M::merge(a, b)                          value of two adjacent segments
+ *      M::add(v, x), M::assign(v, x), ...      operations used by the chosen Action
+ * Action A must provide:
+ *      A::Tag, A::id(), A::isId(tag)
+ *      A::compose(outer, inner)                tag equal to applying inner and then outer
+ *      A::apply(v, tag)                        applies tag to the whole segment value v
+ *
+ * Old classes of this folder are thin wrappers at the end of the file:
+ *      SegTreeAddMn, SegTreeAddMx, SegTreeAddSum, SegTreeMxMnSumAddSet
+ * Iter* versions of them use non-recursive IterLazySegTree engine with the same interface.
+ *
+ * read(l, r) const computes pending tags on the fly and does not change the tree, so many threads may read
+ * one tree while nobody writes, getters of the wrappers called on a const object use it.
+ *
+ * findFirst(l, pred) / findLast(r, pred) descend the tree to find the border of a monotone predicate in O(logN),
+ * e.g. the first element >= x or the shortest prefix with sum >= k.
+ *
+ * add(vector<RangeAdd>) of SegTreeAddSum and SegTreeMxMnSumAddSet applies a batch of range adds,
+ * rebuilding the tree in O(N) when the batch is dense.
+ *
+ * TIME: O(N) building + O(logN) ask and update
+ * Memory: N * 4 * (sizeof(Value) + sizeof(Tag))
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+using ll = long long;
+
+const ll INF18 = 1e18;
+
+struct MinMonoid {
+    struct Value {
+        ll mn;
+    };
+
+    static Value id() {
+        return {INF18};
+    }
+
+    static Value leaf(ll x) {
+        return {x};
+    }
+
+    static Value merge(const Value& A, const Value& B) {
+        return {min(A.mn, B.mn)};
+    }
+
+    static void add(Value& v, ll x) {
+        v.mn += x;
+    }
+
+    static void assign(Value& v, ll x) {
+        v.mn = x;
+    }
+
+    // a >= 0
+    static void affine(Value& v, ll a, ll b) {
+        v.mn = a * v.mn + b;
+    }
+};
+
+struct MaxMonoid {
+    struct Value {
+        ll mx;
+    };
+
+    static Value id() {
+        return {-INF18};
+    }
+
+    static Value leaf(ll x) {
+        return {x};
+    }
+
+    static Value merge(const Value& A, const Value& B) {
+        return {max(A.mx, B.mx)};
+    }
+
+    static void add(Value& v, ll x) {
+        v.mx += x;
+    }
+
+    static void assign(Value& v, ll x) {
+        v.mx = x;
+    }
+
+    // a >= 0
+    static void affine(Value& v, ll a, ll b) {
+        v.mx = a * v.mx + b;
+    }
+};
+
+struct SumMonoid {
+    struct Value {
+        ll sum;
+        ll len;
+    };
+
+    static Value id() {
+        return {0, 0};
+    }
+
+    static Value leaf(ll x) {
+        return {x, 1};
+    }
+
+    static Value merge(const Value& A, const Value& B) {
+        return {A.sum + B.sum, A.len + B.len};
+    }
+
+    static void add(Value& v, ll x) {
+        v.sum += x * v.len;
+    }
+
+    static void assign(Value& v, ll x) {
+        v.sum = x * v.len;
+    }
+
+    static void affine(Value& v, ll a, ll b) {
+        v.sum = a * v.sum + b * v.len;
+    }
+};
+
+struct MxMnSumMonoid {
+    struct Value {
+        ll mn;
+        ll mx;
+        ll sum;
+        ll len;
+    };
+
+    static Value id() {
+        return {INF18, -INF18, 0, 0};
+    }
+
+    static Value leaf(ll x) {
+        return {x, x, x, 1};
+    }
+
+    static Value merge(const Value& A, const Value& B) {
+        return {
+                min(A.mn, B.mn),
+                max(A.mx, B.mx),
+                A.sum + B.sum,
+                A.len + B.len
+        };
+    }
+
+    static void add(Value& v, ll x) {
+        v.mn += x;
+        v.mx += x;
+        v.sum += x * v.len;
+    }
+
+    static void assign(Value& v, ll x) {
+        v = {x, x, x * v.len, v.len};
+    }
+
+    // a >= 0
+    static void affine(Value& v, ll a, ll b) {
+        v = {a * v.mn + b, a * v.mx + b, a * v.sum + b * v.len, v.len};
+    }
+};
+
+template<class M>
+struct AddAction {
+    using Tag = ll;
+
+    static Tag id() {
+        return 0;
+    }
+
+    static bool isId(const Tag& tag) {
+        return !tag;
+    }
+
+    static Tag compose(const Tag& outer, const Tag& inner) {
+        return outer + inner;
+    }
+
+    static void apply(typename M::Value& v, const Tag& tag) {
+        M::add(v, tag);
+    }
+};
+
+template<class M>
+struct SetAction {
+    struct Tag {
+        bool has;
+        ll val;
+    };
+
+    static Tag id() {
+        return {false, 0};
+    }
+
+    static bool isId(const Tag& tag) {
+        return !tag.has;
+    }
+
+    static Tag compose(const Tag& outer, const Tag& inner) {
+        return outer.has ? outer : inner;
+    }
+
+    static void apply(typename M::Value& v, const Tag& tag) {
+        if (tag.has) {
+            M::assign(v, tag.val);
+        }
+    }
+};
+
+// assigns setVal (if hasSet) and then adds add
+template<class M>
+struct AddSetAction {
+    struct Tag {
+        bool hasSet;
+        ll setVal;
+        ll add;
+    };
+
+    static Tag id() {
+        return {false, 0, 0};
+    }
+
+    static bool isId(const Tag& tag) {
+        return !tag.hasSet && !tag.add;
+    }
+
+    static Tag compose(const Tag& outer, const Tag& inner) {
+        if (outer.hasSet) {
+            return outer;
+        }
+
+        return {inner.hasSet, inner.setVal, inner.add + outer.add};
+    }
+
+    static void apply(typename M::Value& v, const Tag& tag) {
+        if (tag.hasSet) {
+            M::assign(v, tag.setVal);
+        }
+
+        if (tag.add) {
+            M::add(v, tag.add);
+        }
+    }
+};
+
+// x -> a * x + b
+template<class M>
+struct AffineAction {
+    struct Tag {
+        ll a;
+        ll b;
+    };
+
+    static Tag id() {
+        return {1, 0};
+    }
+
+    static bool isId(const Tag& tag) {
+        return tag.a == 1 && !tag.b;
+    }
+
+    static Tag compose(const Tag& outer, const Tag& inner) {
+        return {outer.a * inner.a, outer.a * inner.b + outer.b};
+    }
+
+    static void apply(typename M::Value& v, const Tag& tag) {
+        M::affine(v, tag.a, tag.b);
+    }
+};
+
+template<class M, class A>
+class LazySegTree {
+private:
+    using Value = typename M::Value;
+    using Tag = typename A::Tag;
+
+    int sz;
+    vector<Value> tree;
+    // lazy[root] is already applied to tree[root] and must be pushed to the kids
+    vector<Tag> lazy;
+
+    void build(int root, int l, int r, const vector<ll>& src) {
+        if (l == r) {
+            tree[root] = M::leaf(src[l]);
+            return;
+        }
+
+        int m = (l + r) >> 1;
+        int lRoot = (root << 1) + 1;
+        int rRoot = (root << 1) + 2;
+        build(lRoot, l, m, src);
+        build(rRoot, m + 1, r, src);
+        tree[root] = M::merge(tree[lRoot], tree[rRoot]);
+    }
+
+    void applyTag(int root, const Tag& tag) {
+        A::apply(tree[root], tag);
+        lazy[root] = A::compose(tag, lazy[root]);
+    }
+
+    void push(int root) {
+        if (A::isId(lazy[root])) {
+            return;
+        }
+
+        applyTag((root << 1) + 1, lazy[root]);
+        applyTag((root << 1) + 2, lazy[root]);
+        lazy[root] = A::id();
+    }
+
+    // above - tag of the ancestors which is not pushed to root yet
+    Value read(int root, int l, int r, int sL, int sR, const Tag& above) const {
+        if (sL <= l && r <= sR) {
+            Value res = tree[root];
+            A::apply(res, above);
+            return res;
+        }
+
+        Tag next = A::compose(above, lazy[root]);
+        int m = (l + r) >> 1;
+        int lRoot = (root << 1) + 1;
+        int rRoot = (root << 1) + 2;
+        if (sR <= m) {
+            return read(lRoot, l, m, sL, sR, next);
+        } else if (m < sL) {
+            return read(rRoot, m + 1, r, sL, sR, next);
+        } else {
+            return M::merge(read(lRoot, l, m, sL, sR, next), read(rRoot, m + 1, r, sL, sR, next));
+        }
+    }
+
+    Value query(int root, int l, int r, int sL, int sR) {
+        if (sL <= l && r <= sR) {
+            return tree[root];
+        }
+
+        push(root);
+        int m = (l + r) >> 1;
+        int lRoot = (root << 1) + 1;
+        int rRoot = (root << 1) + 2;
+        if (sR <= m) {
+            return query(lRoot, l, m, sL, sR);
+        } else if (m < sL) {
+            return query(rRoot, m + 1, r, sL, sR);
+        } else {
+            return M::merge(query(lRoot, l, m, sL, sR), query(rRoot, m + 1, r, sL, sR));
+        }
+    }
+
+    void update(int root, int l, int r, int sL, int sR, const Tag& tag) {
+        if (sL <= l && r <= sR) {
+            applyTag(root, tag);
+            return;
+        }
+
+        push(root);
+        int m = (l + r) >> 1;
+        int lRoot = (root << 1) + 1;
+        int rRoot = (root << 1) + 2;
+        if (sL <= m) {
+            update(lRoot, l, m, sL, sR, tag);
+        }
+
+        if (m < sR) {
+            update(rRoot, m + 1, r, sL, sR, tag);
+        }
+
+        tree[root] = M::merge(tree[lRoot], tree[rRoot]);
+    }
+
+    void collect(int root, int l, int r, vector<Value>& res) {
+        if (l == r) {
+            res[l] = tree[root];
+            return;
+        }
+
+        push(root);
+        int m = (l + r) >> 1;
+        collect((root << 1) + 1, l, m, res);
+        collect((root << 1) + 2, m + 1, r, res);
+    }
+
+    // acc - merged value of [sL, l), kids are visited only if the answer is inside
+    template<class Pred>
+    int findFirst(int root, int l, int r, int sL, Value& acc, const Pred& pred) {
+        if (r < sL) {
+            return -1;
+        }
+
+        if (sL <= l) {
+            Value merged = M::merge(acc, tree[root]);
+            if (!pred(merged)) {
+                acc = merged;
+                return -1;
+            }
+
+            if (l == r) {
+                return l;
+            }
+        }
+
+        push(root);
+        int m = (l + r) >> 1;
+        int res = findFirst((root << 1) + 1, l, m, sL, acc, pred);
+        if (res != -1) {
+            return res;
+        }
+
+        return findFirst((root << 1) + 2, m + 1, r, sL, acc, pred);
+    }
+
+    // acc - merged value of (r, sR]
+    template<class Pred>
+    int findLast(int root, int l, int r, int sR, Value& acc, const Pred& pred) {
+        if (l > sR) {
+            return -1;
+        }
+
+        if (r <= sR) {
+            Value merged = M::merge(tree[root], acc);
+            if (!pred(merged)) {
+                acc = merged;
+                return -1;
+            }
+
+            if (l == r) {
+                return l;
+            }
+        }
+
+        push(root);
+        int m = (l + r) >> 1;
+        int res = findLast((root << 1) + 2, m + 1, r, sR, acc, pred);
+        if (res != -1) {
+            return res;
+        }
+
+        return findLast((root << 1) + 1, l, m, sR, acc, pred);
+    }
+
+    void set(int root, int l, int r, int pos, const Value& val) {
+        if (l == r) {
+            tree[root] = val;
+            lazy[root] = A::id();
+            return;
+        }
+
+        push(root);
+        int m = (l + r) >> 1;
+        int lRoot = (root << 1) + 1;
+        int rRoot = (root << 1) + 2;
+        if (pos <= m) {
+            set(lRoot, l, m, pos, val);
+        } else {
+            set(rRoot, m + 1, r, pos, val);
+        }
+
+        tree[root] = M::merge(tree[lRoot], tree[rRoot]);
+    }
+
+public:
+    explicit LazySegTree(const vector<ll>& src) : sz(int(src.size())) {
+        tree.resize(1 << (__lg(sz) + 2), M::id());
+        lazy.resize(tree.size(), A::id());
+        build(0, 0, sz - 1, src);
+    }
+
+    explicit LazySegTree(int sz, ll def = 0) : LazySegTree(vector<ll>(sz, def)) {}
+
+    int size() const {
+        return sz;
+    }
+
+    // rebuilds the tree from src of the same size in O(N)
+    void assign(const vector<ll>& src) {
+        fill(lazy.begin(), lazy.end(), A::id());
+        build(0, 0, sz - 1, src);
+    }
+
+    // values of all leaves with all tags pushed, O(N)
+    vector<Value> values() {
+        vector<Value> res(sz);
+        collect(0, 0, sz - 1, res);
+        return res;
+    }
+
+    Value query(int l, int r) {
+        return query(0, 0, sz - 1, l, r);
+    }
+
+    // same as query, but does not change the tree, so it is safe to call from many threads without writers
+    Value read(int l, int r) const {
+        return read(0, 0, sz - 1, l, r, A::id());
+    }
+
+    void update(int l, int r, const Tag& tag) {
+        update(0, 0, sz - 1, l, r, tag);
+    }
+
+    void set(int pos, ll val) {
+        set(0, 0, sz - 1, pos, M::leaf(val));
+    }
+
+    Value get(int pos) {
+        return query(pos, pos);
+    }
+
+    /**
+     * @return the first r >= l such that pred(value of [l, r]) is true or -1,
+     * pred must be monotone: false, ..., false, true, ..., true
+     */
+    template<class Pred>
+    int findFirst(int l, const Pred& pred) {
+        Value acc = M::id();
+        return findFirst(0, 0, sz - 1, l, acc, pred);
+    }
+
+    /**
+     * @return the last l <= r such that pred(value of [l, r]) is true or -1,
+     * pred must be monotone: true, ..., true, false, ..., false
+     */
+    template<class Pred>
+    int findLast(int r, const Pred& pred) {
+        Value acc = M::id();
+        return findLast(0, 0, sz - 1, r, acc, pred);
+    }
+};
+
+/**
+ * Non-recursive engine with the same interface as LazySegTree.
+ * Leaves are at [cap, 2 * cap), cap is the smallest power of two >= N, node k has kids 2k and 2k + 1.
+ * Only nodes on the paths to the two borders of the segment are pushed and pulled.
+ *
+ * Memory: cap * (2 * sizeof(Value) + sizeof(Tag)), cap < 2 * N
+ */
+template<class M, class A>
+class IterLazySegTree {
+private:
+    using Value = typename M::Value;
+    using Tag = typename A::Tag;
+
+    int sz;
+    int log;
+    int cap;
+    vector<Value> tree;
+    vector<Tag> lazy;
+
+    void pull(int k) {
+        tree[k] = M::merge(tree[k << 1], tree[(k << 1) | 1]);
+    }
+
+    void applyTag(int k, const Tag& tag) {
+        A::apply(tree[k], tag);
+        if (k < cap) {
+            lazy[k] = A::compose(tag, lazy[k]);
+        }
+    }
+
+    void push(int k) {
+        if (A::isId(lazy[k])) {
+            return;
+        }
+
+        applyTag(k << 1, lazy[k]);
+        applyTag((k << 1) | 1, lazy[k]);
+        lazy[k] = A::id();
+    }
+
+    // node k covers [l, r], above - tag of the ancestors which is not pushed to k yet
+    Value read(int k, int l, int r, int sL, int sR, const Tag& above) const {
+        if (sL <= l && r <= sR) {
+            Value res = tree[k];
+            A::apply(res, above);
+            return res;
+        }
+
+        Tag next = A::compose(above, lazy[k]);
+        int m = (l + r) >> 1;
+        if (sR <= m) {
+            return read(k << 1, l, m, sL, sR, next);
+        } else if (m < sL) {
+            return read((k << 1) | 1, m + 1, r, sL, sR, next);
+        } else {
+            return M::merge(read(k << 1, l, m, sL, sR, next), read((k << 1) | 1, m + 1, r, sL, sR, next));
+        }
+    }
+
+    // pushes everything above the borders of [l, r), l and r are leaf indexes
+    void pushBorders(int l, int r) {
+        for (int i = log; i >= 1; --i) {
+            if (((l >> i) << i) != l) {
+                push(l >> i);
+            }
+
+            if (((r >> i) << i) != r) {
+                push((r - 1) >> i);
+            }
+        }
+    }
+
+public:
+    explicit IterLazySegTree(const vector<ll>& src) : sz(int(src.size())), log(0) {
+        while ((1 << log) < sz) {
+            ++log;
+        }
+
+        cap = 1 << log;
+        tree.resize(cap << 1, M::id());
+        lazy.resize(cap, A::id());
+        assign(src);
+    }
+
+    explicit IterLazySegTree(int sz, ll def = 0) : IterLazySegTree(vector<ll>(sz, def)) {}
+
+    int size() const {
+        return sz;
+    }
+
+    void assign(const vector<ll>& src) {
+        fill(lazy.begin(), lazy.end(), A::id());
+        for (int i = 0; i < sz; ++i) {
+            tree[cap + i] = M::leaf(src[i]);
+        }
+
+        for (int k = cap - 1; k >= 1; --k) {
+            pull(k);
+        }
+    }
+
+    vector<Value> values() {
+        for (int k = 1; k < cap; ++k) {
+            push(k);
+        }
+
+        return {tree.begin() + cap, tree.begin() + cap + sz};
+    }
+
+    Value read(int l, int r) const {
+        return read(1, 0, cap - 1, l, r, A::id());
+    }
+
+    Value query(int l, int r) {
+        l += cap;
+        r += cap + 1;
+        pushBorders(l, r);
+
+        Value resL = M::id();
+        Value resR = M::id();
+        for (; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) {
+                resL = M::merge(resL, tree[l++]);
+            }
+
+            if (r & 1) {
+                resR = M::merge(tree[--r], resR);
+            }
+        }
+
+        return M::merge(resL, resR);
+    }
+
+    void update(int l, int r, const Tag& tag) {
+        l += cap;
+        r += cap + 1;
+        pushBorders(l, r);
+
+        for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+            if (a & 1) {
+                applyTag(a++, tag);
+            }
+
+            if (b & 1) {
+                applyTag(--b, tag);
+            }
+        }
+
+        for (int i = 1; i <= log; ++i) {
+            if (((l >> i) << i) != l) {
+                pull(l >> i);
+            }
+
+            if (((r >> i) << i) != r) {
+                pull((r - 1) >> i);
+            }
+        }
+    }
+
+    void set(int pos, ll val) {
+        pos += cap;
+        for (int i = log; i >= 1; --i) {
+            push(pos >> i);
+        }
+
+        tree[pos] = M::leaf(val);
+        for (int i = 1; i <= log; ++i) {
+            pull(pos >> i);
+        }
+    }
+
+    Value get(int pos) {
+        pos += cap;
+        for (int i = log; i >= 1; --i) {
+            push(pos >> i);
+        }
+
+        return tree[pos];
+    }
+
+    template<class Pred>
+    int findFirst(int l, const Pred& pred) {
+        l += cap;
+        for (int i = log; i >= 1; --i) {
+            push(l >> i);
+        }
+
+        Value acc = M::id();
+        do {
+            while (!(l & 1)) {
+                l >>= 1;
+            }
+
+            Value merged = M::merge(acc, tree[l]);
+            if (pred(merged)) {
+                while (l < cap) {
+                    push(l);
+                    l <<= 1;
+                    merged = M::merge(acc, tree[l]);
+                    if (!pred(merged)) {
+                        acc = merged;
+                        ++l;
+                    }
+                }
+
+                return l - cap;
+            }
+
+            acc = merged;
+            ++l;
+        } while ((l & -l) != l);
+
+        return -1;
+    }
+
+    template<class Pred>
+    int findLast(int r, const Pred& pred) {
+        r += cap + 1;
+        for (int i = log; i >= 1; --i) {
+            push((r - 1) >> i);
+        }
+
+        Value acc = M::id();
+        do {
+            --r;
+            while (r > 1 && (r & 1)) {
+                r >>= 1;
+            }
+
+            Value merged = M::merge(tree[r], acc);
+            if (pred(merged)) {
+                while (r < cap) {
+                    push(r);
+                    r = (r << 1) | 1;
+                    merged = M::merge(tree[r], acc);
+                    if (!pred(merged)) {
+                        acc = merged;
+                        --r;
+                    }
+                }
+
+                return r - cap;
+            }
+
+            acc = merged;
+        } while ((r & -r) != r);
+
+        return -1;
+    }
+};
+
+struct RangeAdd {
+    int l;
+    int r;
+    ll val;
+};
+
+/**
+ * Applies many range adds at once to a tree whose Value has sum field.
+ * Dense batch (Q * logN >= N) is applied by a difference array and O(N) rebuild,
+ * sparse one is applied update by update.
+ *
+ * TIME: O(N + Q) for dense batch, O(Q * logN) for sparse batch
+ */
+template<class Tree, class MakeTag>
+void addBatch(Tree& tree, const vector<RangeAdd>& updates, const MakeTag& makeTag) {
+    int n = tree.size();
+    if (updates.size() * 4 * (__lg(n) + 1) >= size_t(n)) {
+        vector<ll> diff(n + 1);
+        for (const auto& [l, r, val] : updates) {
+            diff[l] += val;
+            diff[r + 1] -= val;
+        }
+
+        auto vals = tree.values();
+        vector<ll> src(n);
+        ll cur = 0;
+        for (int i = 0; i < n; ++i) {
+            cur += diff[i];
+            src[i] = vals[i].sum + cur;
+        }
+
+        tree.assign(src);
+        return;
+    }
+
+    for (const auto& [l, r, val] : updates) {
+        tree.update(l, r, makeTag(val));
+    }
+}
+
+template<template<class, class> class Tree>
+class BasicSegTreeAddMn {
+private:
+    Tree<MinMonoid, AddAction<MinMonoid>> tree;
+
+public:
+    explicit BasicSegTreeAddMn(const vector<ll>& src) : tree(src) {}
+
+    explicit BasicSegTreeAddMn(int sz) : tree(sz) {}
+
+    ll getMn(int l, int r) {
+        return tree.query(l, r).mn;
+    }
+
+    ll getMn(int l, int r) const {
+        return tree.read(l, r).mn;
+    }
+
+    // first position in [l, r] with value <= x or -1
+    int firstAtMost(int l, int r, ll x) {
+        int pos = tree.findFirst(l, [x](const MinMonoid::Value& v) {
+            return v.mn <= x;
+        });
+        return pos <= r ? pos : -1;
+    }
+
+    // old name of getMn
+    ll getMax(int l, int r) {
+        return getMn(l, r);
+    }
+
+    void add(int l, int r, ll val) {
+        tree.update(l, r, val);
+    }
+};
+
+template<template<class, class> class Tree>
+class BasicSegTreeAddMx {
+private:
+    Tree<MaxMonoid, AddAction<MaxMonoid>> tree;
+
+public:
+    explicit BasicSegTreeAddMx(const vector<ll>& src) : tree(src) {}
+
+    explicit BasicSegTreeAddMx(int sz) : tree(sz) {}
+
+    ll getMax(int l, int r) {
+        return tree.query(l, r).mx;
+    }
+
+    ll getMax(int l, int r) const {
+        return tree.read(l, r).mx;
+    }
+
+    // first position in [l, r] with value >= x or -1
+    int firstAtLeast(int l, int r, ll x) {
+        int pos = tree.findFirst(l, [x](const MaxMonoid::Value& v) {
+            return v.mx >= x;
+        });
+        return pos <= r ? pos : -1;
+    }
+
+    void add(int l, int r, ll val) {
+        tree.update(l, r, val);
+    }
+};
+
+template<template<class, class> class Tree>
+class BasicSegTreeAddSum {
+private:
+    Tree<SumMonoid, AddAction<SumMonoid>> tree;
+
+public:
+    explicit BasicSegTreeAddSum(const vector<ll>& src) : tree(src) {}
+
+    explicit BasicSegTreeAddSum(int sz) : tree(sz) {}
+
+    ll getSum(int l, int r) {
+        return tree.query(l, r).sum;
+    }
+
+    ll getSum(int l, int r) const {
+        return tree.read(l, r).sum;
+    }
+
+    // old name of getSum
+    ll geSum(int l, int r) {
+        return getSum(l, r);
+    }
+
+    // the smallest r with getSum(0, r) >= k or -1, all values must be non-negative
+    int lowerBound(ll k) {
+        return tree.findFirst(0, [k](const SumMonoid::Value& v) {
+            return v.sum >= k;
+        });
+    }
+
+    void add(int l, int r, ll val) {
+        tree.update(l, r, val);
+    }
+
+    void add(const vector<RangeAdd>& updates) {
+        addBatch(tree, updates, [](ll val) {
+            return val;
+        });
+    }
+};
+
+template<template<class, class> class Tree>
+class BasicSegTreeMxMnSumAddSet {
+private:
+    Tree<MxMnSumMonoid, AddSetAction<MxMnSumMonoid>> tree;
+
+public:
+    explicit BasicSegTreeMxMnSumAddSet(ll sz, ll def = 0) : tree(int(sz), def) {}
+
+    explicit BasicSegTreeMxMnSumAddSet(const vector<ll>& src) : tree(src) {}
+
+    ll getMx(ll l, ll r) {
+        return tree.query(int(l), int(r)).mx;
+    }
+
+    ll getMx(ll l, ll r) const {
+        return tree.read(int(l), int(r)).mx;
+    }
+
+    ll getMn(ll l, ll r) {
+        return tree.query(int(l), int(r)).mn;
+    }
+
+    ll getMn(ll l, ll r) const {
+        return tree.read(int(l), int(r)).mn;
+    }
+
+    ll getSum(ll l, ll r) {
+        return tree.query(int(l), int(r)).sum;
+    }
+
+    ll getSum(ll l, ll r) const {
+        return tree.read(int(l), int(r)).sum;
+    }
+
+    ll getVal(ll pos) {
+        return tree.get(int(pos)).sum;
+    }
+
+    ll getVal(ll pos) const {
+        return tree.read(int(pos), int(pos)).sum;
+    }
+
+    void add(ll l, ll r, ll val) {
+        tree.update(int(l), int(r), {false, 0, val});
+    }
+
+    void add(ll pos, ll val) {
+        add(pos, pos, val);
+    }
+
+    void add(const vector<RangeAdd>& updates) {
+        addBatch(tree, updates, [](ll val) {
+            return AddSetAction<MxMnSumMonoid>::Tag{false, 0, val};
+        });
+    }
+
+    void set(ll l, ll r, ll val) {
+        tree.update(int(l), int(r), {true, val, 0});
+    }
+
+    void set(ll pos, ll val) {
+        tree.set(int(pos), val);
+    }
+};
+
+using SegTreeAddMn = BasicSegTreeAddMn<LazySegTree>;
+using SegTreeAddMx = BasicSegTreeAddMx<LazySegTree>;
+using SegTreeAddSum = BasicSegTreeAddSum<LazySegTree>;
+using SegTreeMxMnSumAddSet = BasicSegTreeMxMnSumAddSet<LazySegTree>;
+
+using IterSegTreeAddMn = BasicSegTreeAddMn<IterLazySegTree>;
+using IterSegTreeAddMx = BasicSegTreeAddMx<IterLazySegTree>;
+using IterSegTreeAddSum = BasicSegTreeAddSum<IterLazySegTree>;
+using IterSegTreeMxMnSumAddSet = BasicSegTreeMxMnSumAddSet<IterLazySegTree>;
@@ -0,0 +1,95 @@
+/**
+ * Randomized test of SegTreeMxMnSumAddSet and IterSegTreeMxMnSumAddSet against a naive array.
+ * Random mixes of add and set on segments and in points check composition of AddSetAction tags
+ * (add after set, set after add, several of them on overlapping segments) in both engines,
+ * every operation is followed by a random getMn, getMx, getSum, getVal query, const getters are checked too.
+ *
+ * Build and run: g++ -std=c++17 -O2 LazySegTreeTest.cpp && ./a.out
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "LazySegTree.cpp"
+
+#include <cassert>
+#include <cstdio>
+#include <numeric>
+#include <random>
+
+mt19937 rng(2024);
+
+ll randomInt(ll from, ll to) {
+    return from + ll(rng() % (to - from + 1));
+}
+
+template<class Tree>
+void checkSegment(const vector<ll>& naive, Tree& tree, int l, int r) {
+    ll mn = *min_element(naive.begin() + l, naive.begin() + r + 1);
+    ll mx = *max_element(naive.begin() + l, naive.begin() + r + 1);
+    ll sum = accumulate(naive.begin() + l, naive.begin() + r + 1, 0LL);
+    assert(tree.getMn(l, r) == mn);
+    assert(tree.getMx(l, r) == mx);
+    assert(tree.getSum(l, r) == sum);
+    assert(tree.getVal(l) == naive[l]);
+
+    const Tree& constTree = tree;
+    assert(constTree.getMn(l, r) == mn);
+    assert(constTree.getMx(l, r) == mx);
+    assert(constTree.getSum(l, r) == sum);
+}
+
+template<class Tree>
+void testAgainstNaive(const char *name) {
+    const int TESTS = 2000;
+    const int OPERATIONS = 300;
+    for (int test = 0; test < TESTS; ++test) {
+        int n = int(randomInt(1, 64));
+        vector<ll> naive(n);
+        for (ll& x : naive) {
+            x = randomInt(-1000, 1000);
+        }
+
+        Tree tree(naive);
+        for (int op = 0; op < OPERATIONS; ++op) {
+            int l = int(randomInt(0, n - 1));
+            int r = int(randomInt(l, n - 1));
+            ll val = randomInt(-1000, 1000);
+            switch (randomInt(0, 3)) {
+                case 0:
+                    tree.add(l, r, val);
+                    for (int i = l; i <= r; ++i) {
+                        naive[i] += val;
+                    }
+                    break;
+                case 1:
+                    tree.set(l, r, val);
+                    for (int i = l; i <= r; ++i) {
+                        naive[i] = val;
+                    }
+                    break;
+                case 2:
+                    tree.add(l, val);
+                    naive[l] += val;
+                    break;
+                default:
+                    tree.set(l, val);
+                    naive[l] = val;
+                    break;
+            }
+
+            l = int(randomInt(0, n - 1));
+            r = int(randomInt(l, n - 1));
+            checkSegment(naive, tree, l, r);
+        }
+
+        checkSegment(naive, tree, 0, n - 1);
+    }
+
+    printf("%s: OK\n", name);
+}
+
+int main() {
+    testAgainstNaive<SegTreeMxMnSumAddSet>("SegTreeMxMnSumAddSet");
+    testAgainstNaive<IterSegTreeMxMnSumAddSet>("IterSegTreeMxMnSumAddSet");
+    return 0;
+}
@@ -0,0 +1,225 @@
+/**
+ * Realization of persistent Segment tree data structure in C++ for MAX, MIN, SUM, ADD queries on segments [l, r]
+ * and set for pos (same operations as SegTreeMxMnSumAddSet).
+ * Update copies only the nodes on its path, so every saved version stays available for queries.
+ * Nodes are taken from one pool (bump allocation in a vector), kids are stored as pool indexes.
+ * Nodes created after the last snapshot are not shared with any version, so they are changed in place.
+ * Tags are never pushed: node value includes all adds of its subtree, queries add tags of the ancestors.
+ *
+ * snapshot() saves the current tree and returns its version, restore(version) makes a saved version current.
+ *
+ * TIME: O(N) building + O(logN) ask, update and snapshot is O(1)
+ * Memory: 2 * N + 2 * logN new nodes per update
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+using ll = long long;
+
+class PersistentSegTree {
+private:
+    struct Node {
+        ll mn;
+        ll mx;
+        ll sum;
+        ll lazy;
+        int l;
+        int r;
+    };
+
+    ll sz;
+    vector<Node> pool;
+    // nodes with index >= frozen belong only to the current tree
+    int frozen = 0;
+    int cur;
+    vector<int> roots;
+
+    int own(int v) {
+        if (v >= frozen) {
+            return v;
+        }
+
+        pool.push_back(pool[v]);
+        return int(pool.size()) - 1;
+    }
+
+    void pull(int v, ll len) {
+        const Node& L = pool[pool[v].l];
+        const Node& R = pool[pool[v].r];
+        Node& node = pool[v];
+        node.mn = min(L.mn, R.mn) + node.lazy;
+        node.mx = max(L.mx, R.mx) + node.lazy;
+        node.sum = L.sum + R.sum + node.lazy * len;
+    }
+
+    int build(ll l, ll r, const vector<ll>& src) {
+        int v = int(pool.size());
+        pool.push_back({0, 0, 0, 0, -1, -1});
+        if (l == r) {
+            pool[v].mn = pool[v].mx = pool[v].sum = src[l];
+            return v;
+        }
+
+        ll m = (l + r) >> 1;
+        int lKid = build(l, m, src);
+        int rKid = build(m + 1, r, src);
+        pool[v].l = lKid;
+        pool[v].r = rKid;
+        pull(v, r - l + 1);
+        return v;
+    }
+
+    int add(int v, ll l, ll r, ll sL, ll sR, ll val) {
+        v = own(v);
+        if (sL <= l && r <= sR) {
+            Node& node = pool[v];
+            node.mn += val;
+            node.mx += val;
+            node.sum += val * (r - l + 1);
+            node.lazy += val;
+            return v;
+        }
+
+        ll m = (l + r) >> 1;
+        if (sL <= m) {
+            int kid = add(pool[v].l, l, m, sL, sR, val);
+            pool[v].l = kid;
+        }
+
+        if (m < sR) {
+            int kid = add(pool[v].r, m + 1, r, sL, sR, val);
+            pool[v].r = kid;
+        }
+
+        pull(v, r - l + 1);
+        return v;
+    }
+
+    // above - sum of tags of the ancestors of v
+    int set(int v, ll l, ll r, ll pos, ll val, ll above) {
+        v = own(v);
+        if (l == r) {
+            pool[v] = {val - above, val - above, val - above, 0, -1, -1};
+            return v;
+        }
+
+        ll m = (l + r) >> 1;
+        ll nextAbove = above + pool[v].lazy;
+        if (pos <= m) {
+            int kid = set(pool[v].l, l, m, pos, val, nextAbove);
+            pool[v].l = kid;
+        } else {
+            int kid = set(pool[v].r, m + 1, r, pos, val, nextAbove);
+            pool[v].r = kid;
+        }
+
+        pull(v, r - l + 1);
+        return v;
+    }
+
+    // value of [sL, sR] inside subtree of v, including tag of v, but not of its ancestors
+    Node get(int v, ll l, ll r, ll sL, ll sR) const {
+        const Node& node = pool[v];
+        if (sL <= l && r <= sR) {
+            return node;
+        }
+
+        ll m = (l + r) >> 1;
+        Node res;
+        if (sR <= m) {
+            res = get(node.l, l, m, sL, sR);
+        } else if (m < sL) {
+            res = get(node.r, m + 1, r, sL, sR);
+        } else {
+            Node L = get(node.l, l, m, sL, sR);
+            Node R = get(node.r, m + 1, r, sL, sR);
+            res = {min(L.mn, R.mn), max(L.mx, R.mx), L.sum + R.sum, 0, -1, -1};
+        }
+
+        res.mn += node.lazy;
+        res.mx += node.lazy;
+        res.sum += node.lazy * (min(r, sR) - max(l, sL) + 1);
+        return res;
+    }
+
+public:
+    /**
+     * @param updatesHint expected number of updates, used only to reserve the pool
+     */
+    explicit PersistentSegTree(const vector<ll>& src, ll updatesHint = 0) : sz(ll(src.size())) {
+        pool.reserve(2 * sz + updatesHint * 2 * (__lg(sz) + 2));
+        cur = build(0, sz - 1, src);
+        snapshot();
+    }
+
+    explicit PersistentSegTree(ll sz, ll def = 0, ll updatesHint = 0) :
+            PersistentSegTree(vector<ll>(sz, def), updatesHint) {}
+
+    /**
+     * Saves the current tree.
+     * @return number of the saved version, version 0 is the initial tree
+     */
+    int snapshot() {
+        frozen = int(pool.size());
+        roots.push_back(cur);
+        return int(roots.size()) - 1;
+    }
+
+    // current tree becomes equal to the version, changes after the last snapshot are lost
+    void restore(int version) {
+        cur = roots[version];
+    }
+
+    int versionsCnt() const {
+        return int(roots.size());
+    }
+
+    void add(ll l, ll r, ll val) {
+        cur = add(cur, 0, sz - 1, l, r, val);
+    }
+
+    void add(ll pos, ll val) {
+        add(pos, pos, val);
+    }
+
+    void set(ll pos, ll val) {
+        cur = set(cur, 0, sz - 1, pos, val, 0);
+    }
+
+    ll getMx(ll l, ll r) const {
+        return get(cur, 0, sz - 1, l, r).mx;
+    }
+
+    ll getMn(ll l, ll r) const {
+        return get(cur, 0, sz - 1, l, r).mn;
+    }
+
+    ll getSum(ll l, ll r) const {
+        return get(cur, 0, sz - 1, l, r).sum;
+    }
+
+    ll getVal(ll pos) const {
+        return getSum(pos, pos);
+    }
+
+    ll getMx(int version, ll l, ll r) const {
+        return get(roots[version], 0, sz - 1, l, r).mx;
+    }
+
+    ll getMn(int version, ll l, ll r) const {
+        return get(roots[version], 0, sz - 1, l, r).mn;
+    }
+
+    ll getSum(int version, ll l, ll r) const {
+        return get(roots[version], 0, sz - 1, l, r).sum;
+    }
+
+    ll getVal(int version, ll pos) const {
+        return getSum(version, pos, pos);
+    }
+};
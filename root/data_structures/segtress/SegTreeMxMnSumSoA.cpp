@@ -0,0 +1,195 @@
+/**
+ * Realization of Segment tree data structure in C++ for MAX, MIN, SUM, ADD queries on segments [l, r] and set for pos,
+ * with structure-of-arrays layout (same interface as SegTreeMxMnSumAddSet).
+ * Every aggregate and the add tag live in separate arrays, so getMx reads only mx and lazy, getSum - only sum and lazy.
+ * Tags are never pushed: node value includes all adds of its subtree, the query adds tags of the ancestors,
+ * so reads do not modify the tree at all.
+ * Node of segment [l, r] has kids root + 1 and root + 2 * (m - l + 1), so 2 * N - 1 nodes are used and
+ * every subtree occupies a contiguous block of memory.
+ *
+ * T is the type of values (int is enough when values fit), SumT - the type of sums.
+ *
+ * TIME: O(N) building + O(logN) ask
+ * Memory: 2 * N * (3 * sizeof(T) + sizeof(SumT))
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+using ll = long long;
+
+template<class T = ll, class SumT = ll>
+class SegTreeMxMnSumSoA {
+private:
+    int sz;
+    vector<T> mn;
+    vector<T> mx;
+    vector<SumT> sum;
+    vector<T> lazy;
+
+    void pull(int root, int l, int r, int lRoot, int rRoot) {
+        mn[root] = min(mn[lRoot], mn[rRoot]) + lazy[root];
+        mx[root] = max(mx[lRoot], mx[rRoot]) + lazy[root];
+        sum[root] = sum[lRoot] + sum[rRoot] + SumT(lazy[root]) * (r - l + 1);
+    }
+
+    void build(int root, int l, int r, const vector<T>& src) {
+        if (l == r) {
+            mn[root] = mx[root] = src[l];
+            sum[root] = src[l];
+            return;
+        }
+
+        int m = (l + r) >> 1;
+        int lRoot = root + 1;
+        int rRoot = root + 2 * (m - l + 1);
+        build(lRoot, l, m, src);
+        build(rRoot, m + 1, r, src);
+        pull(root, l, r, lRoot, rRoot);
+    }
+
+    T getMn(int root, int l, int r, int sL, int sR) const {
+        if (sL <= l && r <= sR) {
+            return mn[root];
+        }
+
+        int m = (l + r) >> 1;
+        T res = numeric_limits<T>::max();
+        if (sL <= m) {
+            res = min(res, getMn(root + 1, l, m, sL, sR));
+        }
+
+        if (m < sR) {
+            res = min(res, getMn(root + 2 * (m - l + 1), m + 1, r, sL, sR));
+        }
+
+        return res + lazy[root];
+    }
+
+    T getMx(int root, int l, int r, int sL, int sR) const {
+        if (sL <= l && r <= sR) {
+            return mx[root];
+        }
+
+        int m = (l + r) >> 1;
+        T res = numeric_limits<T>::lowest();
+        if (sL <= m) {
+            res = max(res, getMx(root + 1, l, m, sL, sR));
+        }
+
+        if (m < sR) {
+            res = max(res, getMx(root + 2 * (m - l + 1), m + 1, r, sL, sR));
+        }
+
+        return res + lazy[root];
+    }
+
+    SumT getSum(int root, int l, int r, int sL, int sR) const {
+        if (sL <= l && r <= sR) {
+            return sum[root];
+        }
+
+        int m = (l + r) >> 1;
+        SumT res = 0;
+        if (sL <= m) {
+            res += getSum(root + 1, l, m, sL, sR);
+        }
+
+        if (m < sR) {
+            res += getSum(root + 2 * (m - l + 1), m + 1, r, sL, sR);
+        }
+
+        return res + SumT(lazy[root]) * (min(r, sR) - max(l, sL) + 1);
+    }
+
+    void add(int root, int l, int r, int sL, int sR, T val) {
+        if (sL <= l && r <= sR) {
+            mn[root] += val;
+            mx[root] += val;
+            sum[root] += SumT(val) * (r - l + 1);
+            lazy[root] += val;
+            return;
+        }
+
+        int m = (l + r) >> 1;
+        int lRoot = root + 1;
+        int rRoot = root + 2 * (m - l + 1);
+        if (sL <= m) {
+            add(lRoot, l, m, sL, sR, val);
+        }
+
+        if (m < sR) {
+            add(rRoot, m + 1, r, sL, sR, val);
+        }
+
+        pull(root, l, r, lRoot, rRoot);
+    }
+
+    // above - sum of tags of the ancestors of root
+    void set(int root, int l, int r, int pos, T val, T above) {
+        if (l == r) {
+            mn[root] = mx[root] = val - above;
+            sum[root] = val - above;
+            lazy[root] = 0;
+            return;
+        }
+
+        int m = (l + r) >> 1;
+        int lRoot = root + 1;
+        int rRoot = root + 2 * (m - l + 1);
+        if (pos <= m) {
+            set(lRoot, l, m, pos, val, above + lazy[root]);
+        } else {
+            set(rRoot, m + 1, r, pos, val, above + lazy[root]);
+        }
+
+        pull(root, l, r, lRoot, rRoot);
+    }
+
+public:
+    explicit SegTreeMxMnSumSoA(int sz, T def = 0) : SegTreeMxMnSumSoA(vector<T>(sz, def)) {}
+
+    explicit SegTreeMxMnSumSoA(const vector<T>& src) : sz(int(src.size())) {
+        int nodes = max(2 * sz - 1, 1);
+        mn.resize(nodes);
+        mx.resize(nodes);
+        sum.resize(nodes);
+        lazy.resize(nodes);
+        if (sz) {
+            build(0, 0, sz - 1, src);
+        }
+    }
+
+    T getMx(int l, int r) const {
+        return getMx(0, 0, sz - 1, l, r);
+    }
+
+    T getMn(int l, int r) const {
+        return getMn(0, 0, sz - 1, l, r);
+    }
+
+    SumT getSum(int l, int r) const {
+        return getSum(0, 0, sz - 1, l, r);
+    }
+
+    T getVal(int pos) const {
+        return getMx(pos, pos);
+    }
+
+    void add(int l, int r, T val) {
+        add(0, 0, sz - 1, l, r, val);
+    }
+
+    void add(int pos, T val) {
+        add(pos, pos, val);
+    }
+
+    void set(int pos, T val) {
+        set(0, 0, sz - 1, pos, val, 0);
+    }
+};
@@ -0,0 +1,97 @@
+/**
+ * Benchmark of SegTreeMxMnSumSoA<ll>, SegTreeMxMnSumSoA<int, ll> and SegTreeMxMnSumAddSet on a read-heavy workload:
+ * N random elements, Q random operations - getMx and getSum on random segments, ADD_PERCENT% of them are adds.
+ * All trees get the same operations, answers are checked to be equal.
+ *
+ * Usage: SegTreeMxMnSumSoABenchmark [N = 10^7] [Q = 4 * 10^6]
+ * Build: g++ -std=c++17 -O2 SegTreeMxMnSumSoABenchmark.cpp
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "LazySegTree.cpp"
+#include "SegTreeMxMnSumSoA.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+const int ADD_PERCENT = 2;
+
+struct Operation {
+    int type;
+    int l;
+    int r;
+    ll val;
+};
+
+template<class Tree>
+double run(Tree& tree, const vector<Operation>& ops, vector<ll>& answers) {
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < ops.size(); ++i) {
+        const Operation& op = ops[i];
+        if (op.type == 0) {
+            answers[i] = tree.getMx(op.l, op.r);
+        } else if (op.type == 1) {
+            answers[i] = tree.getSum(op.l, op.r);
+        } else {
+            tree.add(op.l, op.r, op.val);
+        }
+    }
+
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[]) {
+    int N = argc > 1 ? atoi(argv[1]) : 10000000;
+    int Q = argc > 2 ? atoi(argv[2]) : 4000000;
+
+    mt19937 rng(2024);
+    vector<ll> src(N);
+    for (ll& x : src) {
+        x = ll(rng() % 2000001) - 1000000;
+    }
+
+    vector<Operation> ops(Q);
+    for (auto& op : ops) {
+        op.type = int(rng() % 100) < ADD_PERCENT ? 2 : int(rng() % 2);
+        op.l = int(rng() % N);
+        op.r = int(rng() % N);
+        if (op.l > op.r) {
+            swap(op.l, op.r);
+        }
+
+        op.val = ll(rng() % 201) - 100;
+    }
+
+    vector<ll> soaAnswers(Q);
+    vector<ll> soaIntAnswers(Q);
+    vector<ll> aosAnswers(Q);
+    double soaTime;
+    double soaIntTime;
+    double aosTime;
+    {
+        SegTreeMxMnSumSoA<ll> tree(src);
+        soaTime = run(tree, ops, soaAnswers);
+    }
+    {
+        SegTreeMxMnSumSoA<int, ll> tree(vector<int>(src.begin(), src.end()));
+        soaIntTime = run(tree, ops, soaIntAnswers);
+    }
+    {
+        SegTreeMxMnSumAddSet tree(src);
+        aosTime = run(tree, ops, aosAnswers);
+    }
+
+    if (soaAnswers != aosAnswers || soaIntAnswers != aosAnswers) {
+        printf("answers differ\n");
+        return 1;
+    }
+
+    printf("N = %d, Q = %d, adds %d%%\n", N, Q, ADD_PERCENT);
+    printf("SegTreeMxMnSumSoA<ll>       %7.3f s\n", soaTime);
+    printf("SegTreeMxMnSumSoA<int, ll>  %7.3f s\n", soaIntTime);
+    printf("SegTreeMxMnSumAddSet        %7.3f s\n", aosTime);
+    return 0;
+}
@@ -1,36 +1,262 @@
 /**
- * Realization of sieve of Eratosthenes algorithm in C++.
- * Algorithm finds all prime numbers in range [1, N]
+ * Realization of segmented sieve of Eratosthenes algorithm in C++.
+ * Algorithm finds all prime numbers in range [lo, hi), hi up to ~10^12.
+ * Only odd numbers are stored, the range is processed by blocks of SEGMENT_SIZE bytes (fits L2 cache).
  *
- * TIME: O(N * log(log(N)))
- * Memory: O(N)
+ * TIME: O((hi - lo) * log(log(hi)) + sqrt(hi))
+ * Memory: O(sqrt(hi) + SEGMENT_SIZE)
+ *
+ * getPrimeNumbersParallel(N, threadsCnt) sieves [2, N) on threadsCnt threads, its scaling is measured by
+ * EratosthenesParallelBenchmark.cpp.
+ * forEachPrime(lo, hi, visit) and countPrimes(lo, hi) enumerate primes without storing them: O(sqrt(hi)) memory.
  *
  * @author Kirill_Maglysh
 */
 
 #include <vector>
-#include <bitset>
+#include <cmath>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <cstdint>
 
 using namespace std;
 using ll = long long;
 
-const int MAX_ROOT = 1e4;
-const int MAX_N = MAX_ROOT * MAX_ROOT;
+const int SEGMENT_SIZE = 1 << 18;
 
-bitset<MAX_N> isNumComplex;
+ll isqrt(ll n) {
+    ll r = ll(sqrtl((long double) n));
+    while (r * r > n) {
+        --r;
+    }
 
-vector<int> getPrimeNumbers(int N) {
+    while ((r + 1) * (r + 1) <= n) {
+        ++r;
+    }
+
+    return r;
+}
+
+vector<int> getBasePrimes(int limit) {
     vector<int> res;
-    for (int d = 2; d < N; ++d) {
-        if (!isNumComplex[d]) {
-            res.push_back(d);
-            if (d <= MAX_ROOT + 1) {
-                for (int j = d * d; j < N; j += d) {
-                    isNumComplex[j] = true;
-                }
+    if (limit < 2) {
+        return res;
+    }
+
+    res.push_back(2);
+    // isNumComplex[i] describes number 2 * i + 1
+    vector<char> isNumComplex(limit / 2 + 1);
+    for (int i = 1; 2 * i + 1 <= limit; ++i) {
+        if (!isNumComplex[i]) {
+            ll p = 2 * i + 1;
+            res.push_back(int(p));
+            for (ll j = p * p / 2; 2 * j + 1 <= limit; j += p) {
+                isNumComplex[j] = true;
+            }
+        }
+    }
+
+    return res;
+}
+
+/**
+ * Sieves odd numbers of [lo, hi) block by block and calls onSegment(from, len, isNumComplex) for every block,
+ * where isNumComplex[k] describes odd number from + 2 * k, k < len.
+ * Number 2 is not reported, the caller must handle it.
+ */
+template<class SegmentVisitor>
+void sieveSegments(ll lo, ll hi, const vector<int>& basePrimes, SegmentVisitor onSegment) {
+    ll from = max(lo, 3LL) | 1;
+    if (from >= hi) {
+        return;
+    }
+
+    // next[i] - next odd multiple of basePrimes[i] to cross out, basePrimes[0] == 2 is skipped
+    vector<ll> next(basePrimes.size());
+    for (size_t i = 1; i < basePrimes.size(); ++i) {
+        ll p = basePrimes[i];
+        ll start = max(p * p, (from + p - 1) / p * p);
+        if (!(start & 1)) {
+            start += p;
+        }
+
+        next[i] = start;
+    }
+
+    vector<char> isNumComplex(SEGMENT_SIZE);
+    for (; from < hi; from += 2LL * SEGMENT_SIZE) {
+        int len = int(min<ll>(SEGMENT_SIZE, (hi - from + 1) / 2));
+        ll to = from + 2LL * len;
+        fill(isNumComplex.begin(), isNumComplex.begin() + len, false);
+        for (size_t i = 1; i < basePrimes.size(); ++i) {
+            ll p = basePrimes[i];
+            if (p * p >= to) {
+                break;
             }
+
+            ll j = next[i];
+            for (; j < to; j += 2 * p) {
+                isNumComplex[(j - from) >> 1] = true;
+            }
+
+            next[i] = j;
         }
+
+        onSegment(from, len, isNumComplex);
     }
+}
+
+/**
+ * Calls visit(p) for every prime p in [lo, hi) in increasing order without storing them.
+ */
+template<class Visitor>
+void forEachPrime(ll lo, ll hi, const vector<int>& basePrimes, Visitor visit) {
+    if (lo <= 2 && 2 < hi) {
+        visit(2LL);
+    }
+
+    sieveSegments(lo, hi, basePrimes, [&visit](ll from, int len, const vector<char>& isNumComplex) {
+        for (int k = 0; k < len; ++k) {
+            if (!isNumComplex[k]) {
+                visit(from + 2LL * k);
+            }
+        }
+    });
+}
+
+template<class Visitor>
+void forEachPrime(ll lo, ll hi, Visitor visit) {
+    lo = max(lo, 2LL);
+    if (lo >= hi) {
+        return;
+    }
+
+    forEachPrime(lo, hi, getBasePrimes(int(isqrt(hi - 1))), visit);
+}
+
+ll countPrimes(ll lo, ll hi) {
+    lo = max(lo, 2LL);
+    if (lo >= hi) {
+        return 0;
+    }
+
+    ll cnt = (lo == 2);
+    sieveSegments(lo, hi, getBasePrimes(int(isqrt(hi - 1))),
+                  [&cnt](ll, int len, const vector<char>& isNumComplex) {
+                      cnt += count(isNumComplex.begin(), isNumComplex.begin() + len, false);
+                  });
+
+    return cnt;
+}
+
+void collectPrimes(ll lo, ll hi, const vector<int>& basePrimes, vector<ll>& res) {
+    forEachPrime(lo, hi, basePrimes, [&res](ll p) {
+        res.push_back(p);
+    });
+}
+
+vector<ll> primesInRange(ll lo, ll hi) {
+    vector<ll> res;
+    lo = max(lo, 2LL);
+    if (lo >= hi) {
+        return res;
+    }
+
+    collectPrimes(lo, hi, getBasePrimes(int(isqrt(hi - 1))), res);
+    return res;
+}
+
+vector<int> getPrimeNumbers(int N) {
+    vector<int> res;
+    forEachPrime(2, N, [&res](ll p) {
+        res.push_back(int(p));
+    });
+
+    return res;
+}
+
+/**
+ * Calls work(id) for every chunk id in [0, chunksCnt) on threadsCnt threads, threads take chunks one by one.
+ */
+template<class ChunkWork>
+void forEachChunkParallel(int chunksCnt, int threadsCnt, ChunkWork work) {
+    atomic<int> nextChunk(0);
+    auto worker = [&]() {
+        for (int id = nextChunk++; id < chunksCnt; id = nextChunk++) {
+            work(id);
+        }
+    };
+
+    vector<thread> threads;
+    for (int i = 1; i < min(threadsCnt, chunksCnt); ++i) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+/**
+ * Parallel version of primesInRange(2, N).
+ * [2, N) is split into chunks of several segments, threads share the base primes.
+ * First pass sieves the chunks and saves primality of odd numbers as bits with the count of primes of every chunk,
+ * second pass writes primes of every chunk straight to its offset in the result.
+ *
+ * Memory: result + N / 16 bytes
+ */
+vector<ll> getPrimeNumbersParallel(ll N, int threadsCnt = int(thread::hardware_concurrency())) {
+    threadsCnt = max(threadsCnt, 1);
+    if (N <= 2) {
+        return {};
+    }
+
+    vector<int> basePrimes = getBasePrimes(int(isqrt(N - 1)));
+    const ll chunkLen = 2LL * SEGMENT_SIZE * 4;
+    const ll chunkWords = chunkLen / 2 / 64;
+    int chunksCnt = int((N - 2 + chunkLen - 1) / chunkLen);
+    // bit k of chunk id describes odd number 2 + id * chunkLen + 1 + 2 * k
+    vector<uint64_t> isPrimeBits(size_t(chunksCnt) * chunkWords);
+    // offsets[id + 1] - number of primes in chunk id, then prefix sums, offsets[0] is for number 2
+    vector<ll> offsets(chunksCnt + 1);
+
+    forEachChunkParallel(chunksCnt, threadsCnt, [&](int id) {
+        ll lo = 2 + id * chunkLen;
+        uint64_t *bits = isPrimeBits.data() + id * chunkWords;
+        ll cnt = 0;
+        sieveSegments(lo, min(N, lo + chunkLen), basePrimes,
+                      [&](ll from, int len, const vector<char>& isNumComplex) {
+                          ll first = (from - lo - 1) / 2;
+                          for (int k = 0; k < len; ++k) {
+                              if (!isNumComplex[k]) {
+                                  bits[(first + k) >> 6] |= 1ULL << ((first + k) & 63);
+                                  ++cnt;
+                              }
+                          }
+                      });
+
+        offsets[id + 1] = cnt;
+    });
+
+    offsets[0] = 1;
+    for (int id = 0; id < chunksCnt; ++id) {
+        offsets[id + 1] += offsets[id];
+    }
+
+    vector<ll> res(offsets[chunksCnt]);
+    res[0] = 2;
+    forEachChunkParallel(chunksCnt, threadsCnt, [&](int id) {
+        ll first = 2 + id * chunkLen + 1;
+        const uint64_t *bits = isPrimeBits.data() + id * chunkWords;
+        ll *out = res.data() + offsets[id];
+        for (ll w = 0; w < chunkWords; ++w) {
+            for (uint64_t word = bits[w]; word; word &= word - 1) {
+                *out++ = first + 2 * (w * 64 + __builtin_ctzll(word));
+            }
+        }
+    });
 
     return res;
-}
\ No newline at end of file
+}
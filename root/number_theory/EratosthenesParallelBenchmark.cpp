@@ -0,0 +1,44 @@
+/**
+ * Scaling benchmark of getPrimeNumbersParallel: sieves [2, N) with 1, 2, 4, ... threads up to the number of cores
+ * and prints time and speedup relative to one thread. Number of primes is checked to be the same for every run.
+ *
+ * Usage: EratosthenesParallelBenchmark [N = 10^9] [maxThreads = hardware_concurrency]
+ * Build: g++ -std=c++17 -O2 -pthread EratosthenesParallelBenchmark.cpp
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include "Eratosthenes.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char *argv[]) {
+    ll N = argc > 1 ? atoll(argv[1]) : 1000000000LL;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : max(int(thread::hardware_concurrency()), 1);
+
+    double oneThreadTime = 0;
+    size_t primesCnt = 0;
+    for (int threadsCnt = 1;; threadsCnt = min(threadsCnt * 2, maxThreads)) {
+        auto start = chrono::steady_clock::now();
+        size_t cnt = getPrimeNumbersParallel(N, threadsCnt).size();
+        double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        if (threadsCnt == 1) {
+            oneThreadTime = time;
+            primesCnt = cnt;
+        } else if (cnt != primesCnt) {
+            printf("wrong number of primes on %d threads: %zu instead of %zu\n", threadsCnt, cnt, primesCnt);
+            return 1;
+        }
+
+        printf("threads %3d  time %8.3f s  speedup %5.2f\n", threadsCnt, time, oneThreadTime / time);
+        if (threadsCnt >= maxThreads) {
+            break;
+        }
+    }
+
+    printf("N = %lld, primes: %zu\n", N, primesCnt);
+    return 0;
+}
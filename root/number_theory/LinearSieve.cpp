@@ -0,0 +1,163 @@
+/**
+ * Realization of linear sieve of Eratosthenes algorithm in C++.
+ * Algorithm finds the smallest prime divisor of every number in range [1, N] and all primes up to N.
+ * Smallest prime divisors are used for fast factorization and for bulk computation of
+ * multiplicative functions: Euler's phi, Mobius mu, number of divisors and sum of divisors.
+ *
+ * TIME: O(N) building + O(log(x)) factorization of x <= N, O(N) for every multiplicative function table
+ * Memory: 4 * N bytes + primes
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+using ll = long long;
+using ull = unsigned long long;
+
+class LinearSieve {
+private:
+    uint32_t n;
+    vector<uint32_t> spf;
+    vector<uint32_t> primes;
+
+public:
+    explicit LinearSieve(uint32_t n) : n(n), spf(n + 1) {
+        for (uint32_t i = 2; i <= n; ++i) {
+            if (!spf[i]) {
+                spf[i] = i;
+                primes.push_back(i);
+            }
+
+            for (uint32_t p : primes) {
+                if (p > spf[i] || ull(i) * p > n) {
+                    break;
+                }
+
+                spf[i * p] = p;
+            }
+        }
+    }
+
+    const vector<uint32_t>& getPrimes() const {
+        return primes;
+    }
+
+    bool isPrime(uint32_t x) const {
+        return x >= 2 && spf[x] == x;
+    }
+
+    uint32_t minPrimeDivisor(uint32_t x) const {
+        return spf[x];
+    }
+
+    /**
+     * @return pairs (prime, power) in increasing order of primes, x must be in [1, N]
+     */
+    vector<pair<uint32_t, int>> factorize(uint32_t x) const {
+        vector<pair<uint32_t, int>> res;
+        while (x > 1) {
+            uint32_t p = spf[x];
+            int pw = 0;
+            while (spf[x] == p) {
+                x /= p;
+                ++pw;
+            }
+
+            res.emplace_back(p, pw);
+        }
+
+        return res;
+    }
+
+    vector<vector<pair<uint32_t, int>>> factorize(const vector<uint32_t>& xs) const {
+        vector<vector<pair<uint32_t, int>>> res(xs.size());
+        for (size_t i = 0; i < xs.size(); ++i) {
+            res[i] = factorize(xs[i]);
+        }
+
+        return res;
+    }
+
+    vector<uint32_t> phi() const {
+        vector<uint32_t> res(n + 1);
+        if (n >= 1) {
+            res[1] = 1;
+        }
+
+        for (uint32_t i = 2; i <= n; ++i) {
+            uint32_t p = spf[i];
+            uint32_t j = i / p;
+            res[i] = spf[j] == p ? res[j] * p : res[j] * (p - 1);
+        }
+
+        return res;
+    }
+
+    vector<int8_t> mu() const {
+        vector<int8_t> res(n + 1);
+        if (n >= 1) {
+            res[1] = 1;
+        }
+
+        for (uint32_t i = 2; i <= n; ++i) {
+            uint32_t p = spf[i];
+            uint32_t j = i / p;
+            res[i] = spf[j] == p ? 0 : int8_t(-res[j]);
+        }
+
+        return res;
+    }
+
+    vector<uint32_t> divisorsCnt() const {
+        vector<uint32_t> res(n + 1);
+        // power of the smallest prime divisor
+        vector<uint8_t> pw(n + 1);
+        if (n >= 1) {
+            res[1] = 1;
+        }
+
+        for (uint32_t i = 2; i <= n; ++i) {
+            uint32_t p = spf[i];
+            uint32_t j = i / p;
+            if (spf[j] == p) {
+                pw[i] = pw[j] + 1;
+                res[i] = res[j] / (pw[j] + 1) * (pw[i] + 1);
+            } else {
+                pw[i] = 1;
+                res[i] = res[j] * 2;
+            }
+        }
+
+        return res;
+    }
+
+    vector<ull> divisorsSum() const {
+        vector<ull> res(n + 1);
+        // spfPart[i] = p^k, where p = spf[i] and p^k is the max power of p dividing i
+        vector<uint32_t> spfPart(n + 1);
+        // geo[i] = 1 + p + ... + p^k
+        vector<ull> geo(n + 1);
+        if (n >= 1) {
+            res[1] = 1;
+        }
+
+        for (uint32_t i = 2; i <= n; ++i) {
+            uint32_t p = spf[i];
+            uint32_t j = i / p;
+            if (spf[j] == p) {
+                spfPart[i] = spfPart[j] * p;
+                geo[i] = geo[j] * p + 1;
+            } else {
+                spfPart[i] = p;
+                geo[i] = p + 1;
+            }
+
+            res[i] = res[i / spfPart[i]] * geo[i];
+        }
+
+        return res;
+    }
+};
@@ -0,0 +1,280 @@
+/**
+ * Realization of 64-bit primality test and factorization in C++.
+ * Primality: deterministic Miller-Rabin for all 64-bit numbers (7 fixed bases).
+ * Factorization: Pollard's rho with Brent's cycle detection and batched gcd.
+ * All modular multiplications use Montgomery form, numbers below smallN are handled by smallest prime divisor table.
+ *
+ * TIME: O(smallN) building, O(log^3(n)) isPrime, expected O(n^(1/4) * log(n)) factorization
+ * Memory: 4 * smallN bytes
+ *
+ * @author Kirill_Maglysh
+*/
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+using namespace std;
+using ull = unsigned long long;
+using u128 = __uint128_t;
+
+ull binaryGcd(ull a, ull b) {
+    if (!a || !b) {
+        return a | b;
+    }
+
+    int shift = __builtin_ctzll(a | b);
+    a >>= __builtin_ctzll(a);
+    while (b) {
+        b >>= __builtin_ctzll(b);
+        if (a > b) {
+            swap(a, b);
+        }
+
+        b -= a;
+    }
+
+    return a << shift;
+}
+
+struct Montgomery {
+    ull mod;
+    ull inv;
+    ull r2;
+
+    // mod must be odd
+    explicit Montgomery(ull mod) : mod(mod), inv(mod) {
+        for (int i = 0; i < 5; ++i) {
+            inv *= 2 - mod * inv;
+        }
+
+        u128 r = (u128(1) << 64) % mod;
+        r2 = ull(r * r % mod);
+    }
+
+    ull reduce(u128 x) const {
+        ull q = ull(x) * inv;
+        ull h = ull(x >> 64);
+        ull mq = ull((u128(q) * mod) >> 64);
+        return h >= mq ? h - mq : h + mod - mq;
+    }
+
+    ull toMont(ull a) const {
+        return reduce(u128(a % mod) * r2);
+    }
+
+    ull fromMont(ull a) const {
+        return reduce(a);
+    }
+
+    ull mul(ull a, ull b) const {
+        return reduce(u128(a) * b);
+    }
+
+    ull pow(ull a, ull p) const {
+        ull res = toMont(1);
+        while (p) {
+            if (p & 1) {
+                res = mul(res, a);
+            }
+
+            a = mul(a, a);
+            p >>= 1;
+        }
+
+        return res;
+    }
+};
+
+class Factorizer {
+private:
+    uint32_t smallN;
+    vector<uint32_t> spf;
+    vector<uint32_t> primes;
+
+    bool millerRabin(ull n) const {
+        ull d = n - 1;
+        int s = __builtin_ctzll(d);
+        d >>= s;
+
+        Montgomery mg(n);
+        ull one = mg.toMont(1);
+        ull minusOne = mg.toMont(n - 1);
+        for (ull a : {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}) {
+            if (a % n == 0) {
+                continue;
+            }
+
+            ull x = mg.pow(mg.toMont(a), d);
+            if (x == one || x == minusOne) {
+                continue;
+            }
+
+            bool composite = true;
+            for (int i = 1; i < s && composite; ++i) {
+                x = mg.mul(x, x);
+                composite = x != minusOne;
+            }
+
+            if (composite) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // n must be odd and composite
+    ull rho(ull n) const {
+        const int BATCH = 128;
+        Montgomery mg(n);
+        auto diff = [](ull a, ull b) {
+            return a > b ? a - b : b - a;
+        };
+
+        for (ull c = 1;; ++c) {
+            ull cM = mg.toMont(c);
+            auto f = [&](ull x) {
+                ull res = mg.mul(x, x) + cM;
+                // for n > 2^63 the sum may wrap around 2^64
+                return res < cM || res >= n ? res - n : res;
+            };
+
+            ull x = 0;
+            ull y = mg.toMont(2);
+            ull ys = y;
+            ull q = mg.toMont(1);
+            ull g = 1;
+            for (ull r = 1; g == 1; r <<= 1) {
+                x = y;
+                for (ull i = 0; i < r; ++i) {
+                    y = f(y);
+                }
+
+                for (ull k = 0; k < r && g == 1; k += BATCH) {
+                    ys = y;
+                    for (ull i = 0; i < BATCH && i < r - k; ++i) {
+                        y = f(y);
+                        q = mg.mul(q, diff(x, y));
+                    }
+
+                    g = binaryGcd(q, n);
+                }
+            }
+
+            if (g == n) {
+                do {
+                    ys = f(ys);
+                    g = binaryGcd(diff(x, ys), n);
+                } while (g == 1);
+            }
+
+            if (g != n) {
+                return g;
+            }
+        }
+    }
+
+    void factorize(ull n, vector<ull>& res) const {
+        if (n < smallN) {
+            while (n > 1) {
+                res.push_back(spf[n]);
+                n /= spf[n];
+            }
+
+            return;
+        }
+
+        if (isPrime(n)) {
+            res.push_back(n);
+            return;
+        }
+
+        ull d = rho(n);
+        factorize(d, res);
+        factorize(n / d, res);
+    }
+
+public:
+    /**
+     * @param smallN size of the table, at least 67 is used, so that 2 and all trial division primes (<= 64)
+     * are in the table and rho gets only odd numbers
+     */
+    explicit Factorizer(uint32_t smallN = 1 << 16) : smallN(max(smallN, 67u)), spf(this->smallN) {
+        for (uint32_t i = 2; i < this->smallN; ++i) {
+            if (!spf[i]) {
+                spf[i] = i;
+                primes.push_back(i);
+            }
+
+            for (uint32_t p : primes) {
+                if (p > spf[i] || ull(i) * p >= this->smallN) {
+                    break;
+                }
+
+                spf[i * p] = p;
+            }
+        }
+    }
+
+    bool isPrime(ull n) const {
+        if (n < smallN) {
+            return n >= 2 && spf[n] == n;
+        }
+
+        if (!(n & 1)) {
+            return false;
+        }
+
+        for (int i = 1; i < 16 && i < int(primes.size()); ++i) {
+            if (n % primes[i] == 0) {
+                return false;
+            }
+        }
+
+        return millerRabin(n);
+    }
+
+    /**
+     * @return pairs (prime, power) in increasing order of primes
+     */
+    vector<pair<ull, int>> factorize(ull n) const {
+        vector<ull> divs;
+        // trial division by small primes is cheaper than rho for them
+        for (uint32_t p : primes) {
+            if (ull(p) * p > n || p > 64) {
+                break;
+            }
+
+            while (n % p == 0) {
+                divs.push_back(p);
+                n /= p;
+            }
+        }
+
+        if (n > 1) {
+            factorize(n, divs);
+        }
+
+        sort(divs.begin(), divs.end());
+        vector<pair<ull, int>> res;
+        for (ull p : divs) {
+            if (res.empty() || res.back().first != p) {
+                res.emplace_back(p, 0);
+            }
+
+            ++res.back().second;
+        }
+
+        return res;
+    }
+
+    vector<vector<pair<ull, int>>> factorize(const vector<ull>& xs) const {
+        vector<vector<pair<ull, int>>> res(xs.size());
+        for (size_t i = 0; i < xs.size(); ++i) {
+            res[i] = factorize(xs[i]);
+        }
+
+        return res;
+    }
+};